@@ -0,0 +1,177 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+/* Packs the embedded font bitmaps into 1-bpp glyph arrays.
+
+   The fonts are maintained as BMP images in src/fonts/font1.h ... font5.h. This tool decodes
+   them and writes src/fonts/font_data.h, which is what m8c is built with, so that no BMP has to be
+   parsed or color keyed at runtime. Run it after changing a font, e.g. with
+   cmake -DBUILD_FONT_PACKER=ON and the pack_fonts target.
+
+   usage: font_packer <output file>
+
+   Each glyph is stored as glyph_y rows of (glyph width + 7) / 8 bytes, most significant bit first.
+   A set bit is a white pixel, a clear bit is transparent. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../src/fonts/font1.h"
+#include "../src/fonts/font2.h"
+#include "../src/fonts/font3.h"
+#include "../src/fonts/font4.h"
+#include "../src/fonts/font5.h"
+
+// Must match FONTS_GLYPH_COUNT in src/fonts/fonts.h
+#define GLYPH_COUNT 94
+#define BYTES_PER_LINE 16
+
+typedef struct {
+  const char *name;
+  const struct inline_font_bmp *font;
+} font_source_s;
+
+// Same order as fonts_get()
+static const font_source_s sources[] = {{"font_v1_small", &font_v1_small},
+                                        {"font_v1_large", &font_v1_large},
+                                        {"font_v2_small", &font_v2_small},
+                                        {"font_v2_large", &font_v2_large},
+                                        {"font_v2_huge", &font_v2_huge}};
+#define SOURCE_COUNT (sizeof(sources) / sizeof(sources[0]))
+
+static unsigned int read_u16(const unsigned char *data) { return data[0] | data[1] << 8; }
+
+static unsigned long read_u32(const unsigned char *data) {
+  return (unsigned long)data[0] | (unsigned long)data[1] << 8 | (unsigned long)data[2] << 16 |
+         (unsigned long)data[3] << 24;
+}
+
+typedef struct {
+  const unsigned char *pixels;
+  long width, height;
+  unsigned long stride;
+  int bottom_up;
+  int set_index; // Palette index of the white glyph pixels
+} bitmap_s;
+
+static int parse_bitmap(const font_source_s *source, bitmap_s *bitmap) {
+  const unsigned char *data = source->font->image_data;
+  const long size = source->font->image_size;
+
+  if (size < 54 || data[0] != 'B' || data[1] != 'M') {
+    fprintf(stderr, "%s: not a BMP image\n", source->name);
+    return 0;
+  }
+  const unsigned long pixel_offset = read_u32(data + 10);
+  const unsigned long header_size = read_u32(data + 14);
+  const long width = (long)(int)read_u32(data + 18);
+  const long height = (long)(int)read_u32(data + 22);
+  const unsigned int bits_per_pixel = read_u16(data + 28);
+  const unsigned long compression = read_u32(data + 30);
+
+  if (bits_per_pixel != 1 || compression != 0) {
+    fprintf(stderr, "%s: only uncompressed 1-bpp images are supported\n", source->name);
+    return 0;
+  }
+
+  // Two palette entries, BGRX. The glyphs are the non-black one.
+  const unsigned char *palette = data + 14 + header_size;
+  bitmap->set_index = palette[0] || palette[1] || palette[2] ? 0 : 1;
+  const unsigned char *set_color = palette + 4 * bitmap->set_index;
+  if (set_color[0] != 0xFF || set_color[1] != 0xFF || set_color[2] != 0xFF) {
+    fprintf(stderr, "%s: glyphs must be white on black\n", source->name);
+    return 0;
+  }
+
+  bitmap->width = width;
+  bitmap->height = height < 0 ? -height : height;
+  bitmap->bottom_up = height > 0;
+  bitmap->stride = ((unsigned long)width + 31) / 32 * 4;
+  bitmap->pixels = data + pixel_offset;
+
+  if (width != source->font->width || bitmap->height != source->font->height ||
+      width % GLYPH_COUNT != 0 ||
+      pixel_offset + bitmap->stride * (unsigned long)bitmap->height > (unsigned long)size) {
+    fprintf(stderr, "%s: image size doesn't match the font metrics\n", source->name);
+    return 0;
+  }
+  return 1;
+}
+
+static int pixel_set(const bitmap_s *bitmap, long x, long y) {
+  const long row = bitmap->bottom_up ? bitmap->height - 1 - y : y;
+  const unsigned char byte = bitmap->pixels[(unsigned long)row * bitmap->stride + x / 8];
+  return ((byte >> (7 - x % 8)) & 1) == bitmap->set_index;
+}
+
+static int write_font(FILE *out, const font_source_s *source, size_t *packed_bytes) {
+  bitmap_s bitmap;
+  if (!parse_bitmap(source, &bitmap)) {
+    return 0;
+  }
+
+  const struct inline_font_bmp *font = source->font;
+  const long glyph_width = bitmap.width / GLYPH_COUNT;
+  const long row_bytes = (glyph_width + 7) / 8;
+  const long size = GLYPH_COUNT * bitmap.height * row_bytes;
+
+  fprintf(out, "static const unsigned char %s_glyphs[%ld] = {", source->name, size);
+  long written = 0;
+  for (long glyph = 0; glyph < GLYPH_COUNT; glyph++) {
+    for (long y = 0; y < bitmap.height; y++) {
+      for (long byte = 0; byte < row_bytes; byte++) {
+        unsigned int value = 0;
+        for (long bit = 0; bit < 8 && byte * 8 + bit < glyph_width; bit++) {
+          if (pixel_set(&bitmap, glyph * glyph_width + byte * 8 + bit, y)) {
+            value |= 0x80u >> bit;
+          }
+        }
+        fprintf(out, "%s0x%02X,", written % BYTES_PER_LINE == 0 ? "\n    " : " ", value);
+        written++;
+      }
+    }
+  }
+  fprintf(out, "\n};\n\n");
+
+  fprintf(out,
+          "static const struct inline_font %s = {\n    %d, %d, %d, %d, %d, %d, %d, %d, %ld, %ld, "
+          "%s_glyphs};\n\n",
+          source->name, font->width, font->height, font->glyph_x, font->glyph_y,
+          font->screen_offset_x, font->screen_offset_y, font->text_offset_y,
+          font->waveform_max_height, glyph_width, row_bytes, source->name);
+
+  printf("%s: %ld byte BMP packed into %ld bytes\n", source->name, font->image_size, size);
+  *packed_bytes += (size_t)size;
+  return 1;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc != 2) {
+    fprintf(stderr, "usage: font_packer <output file>\n");
+    return EXIT_FAILURE;
+  }
+
+  FILE *out = fopen(argv[1], "w");
+  if (out == NULL) {
+    fprintf(stderr, "Couldn't open %s\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  fprintf(out, "// Generated by bench/font_packer.c from font1.h ... font5.h, do not edit.\n");
+  fprintf(out, "#ifndef FONT_DATA_H_\n#define FONT_DATA_H_\n\n#include \"fonts.h\"\n\n");
+
+  size_t packed_bytes = 0;
+  for (size_t i = 0; i < SOURCE_COUNT; i++) {
+    if (!write_font(out, &sources[i], &packed_bytes)) {
+      fclose(out);
+      remove(argv[1]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  fprintf(out, "#endif // FONT_DATA_H_\n");
+  fclose(out);
+  printf("%zu bytes of glyphs written to %s\n", packed_bytes, argv[1]);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,440 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+/* Simulated M8 on a pseudo-terminal, for testing the serial backend without hardware.
+
+   Answers the commands m8c sends over serial (E, R, X, D, C and K) and streams SLIP framed
+   display packets from a synthetic workload or a capture file at a fixed frame rate. Point m8c
+   at it with --dev <pty or link path>; devices that aren't detected USB ports are opened by path.
+
+   usage: m8_simulator [--workload <name> | --capture <file>] [--rate <frames/s>]
+                       [--link <path>] [--disconnect-after <seconds>] [--latency-probe]
+
+   --rate 0 sends frames as fast as m8c reads them. --disconnect-after hangs up the terminal after
+   the given time and opens a new one two seconds later, with --link pointing to the new one.
+   --latency-probe follows each frame with a timestamped probe (see latency_probe.h), from which
+   m8c logs the serial reader's write-to-queue latency at debug level. */
+
+// For posix_openpt() and the other pseudo-terminal functions
+#define _GNU_SOURCE
+
+#include <SDL3/SDL.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "../src/backends/latency_probe.h"
+#include "workloads.h"
+
+#define DEFAULT_RATE 60
+#define WORKLOAD_FRAMES 600
+#define OUTPUT_BUFFER_SIZE (256 * 1024)
+#define READ_SIZE 256
+#define STATS_INTERVAL_NS (5 * SDL_NS_PER_SECOND)
+#define RECONNECT_DELAY_NS (2 * SDL_NS_PER_SECOND)
+
+typedef struct {
+  int master_fd;
+  int slave_fd; // Kept open so that the terminal doesn't hang up between m8c connections
+  char slave_path[128];
+} pty_s;
+
+// Position in the workload
+typedef struct {
+  size_t frame;
+  size_t packet;
+  size_t offset;
+} cursor_s;
+
+static volatile sig_atomic_t stop_requested = 0;
+
+static workload_s workload;
+static cursor_s cursor;
+static cursor_s loop_start; // Frame 0 sets up the display, loops start after it
+
+static Uint8 output[OUTPUT_BUFFER_SIZE];
+static size_t output_used = 0;
+static size_t output_sent = 0;
+
+static int display_enabled = 0;
+static int latency_probe = 0;
+static int probe_pending = 0; // A frame was queued and its probe hasn't been written yet
+
+// Command parser state
+static Uint8 command = 0;
+static Uint8 arguments[2];
+static int argument_count = 0;
+static int arguments_needed = 0;
+
+static struct {
+  Uint64 frames_sent;
+  Uint64 frames_dropped;
+  Uint64 bytes_sent;
+  Uint64 inputs;
+  Uint64 keyjazz;
+  Uint64 pings;
+  Uint64 ticks_ns;
+} stats;
+
+static void handle_signal(int signal) {
+  (void)signal;
+  stop_requested = 1;
+}
+
+static int open_pty(pty_s *pty, const char *link_path) {
+  struct termios tio;
+
+  pty->master_fd = posix_openpt(O_RDWR | O_NOCTTY);
+  if (pty->master_fd < 0 || grantpt(pty->master_fd) != 0 || unlockpt(pty->master_fd) != 0) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Cannot open a pseudo-terminal: %s", strerror(errno));
+    return 0;
+  }
+  SDL_strlcpy(pty->slave_path, ptsname(pty->master_fd), sizeof(pty->slave_path));
+  fcntl(pty->master_fd, F_SETFL, fcntl(pty->master_fd, F_GETFL) | O_NONBLOCK);
+
+  pty->slave_fd = open(pty->slave_path, O_RDWR | O_NOCTTY);
+  if (pty->slave_fd < 0 || tcgetattr(pty->slave_fd, &tio) != 0) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Cannot open %s: %s", pty->slave_path, strerror(errno));
+    return 0;
+  }
+  cfmakeraw(&tio);
+  tcsetattr(pty->slave_fd, TCSANOW, &tio);
+
+  if (link_path != NULL) {
+    unlink(link_path);
+    if (symlink(pty->slave_path, link_path) != 0) {
+      SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Cannot link %s: %s", link_path, strerror(errno));
+    }
+  }
+
+  SDL_Log("Simulated M8 on %s%s%s", pty->slave_path, link_path != NULL ? ", linked from " : "",
+          link_path != NULL ? link_path : "");
+  return 1;
+}
+
+static void close_pty(pty_s *pty) {
+  if (pty->slave_fd >= 0) {
+    close(pty->slave_fd);
+  }
+  if (pty->master_fd >= 0) {
+    close(pty->master_fd);
+  }
+  pty->master_fd = pty->slave_fd = -1;
+}
+
+static void reset_output(void) {
+  output_used = 0;
+  output_sent = 0;
+}
+
+// Queue a SLIP encoded packet. Returns 0 if the output buffer is full.
+static int queue_packet(const Uint8 *packet, const Uint32 size) {
+  if (output_sent > 0 && output_sent == output_used) {
+    reset_output();
+  }
+  if (output_used + size * 2 + 1 > OUTPUT_BUFFER_SIZE) {
+    SDL_memmove(output, output + output_sent, output_used - output_sent);
+    output_used -= output_sent;
+    output_sent = 0;
+    if (output_used + size * 2 + 1 > OUTPUT_BUFFER_SIZE) {
+      return 0;
+    }
+  }
+  output_used += workload_encode_slip(packet, size, output + output_used);
+  return 1;
+}
+
+// Queue the next frame of the workload, unless m8c is too far behind to take it. Returns 0 if the
+// frame was dropped.
+static int queue_frame(void) {
+  int queued = 0;
+  const Uint32 packets = workload.frame_packets[cursor.frame];
+  size_t frame_size = 0;
+
+  for (Uint32 i = 0; i < packets; i++) {
+    frame_size += workload.packet_sizes[cursor.packet + i] * 2 + 1;
+  }
+
+  if (output_used - output_sent + frame_size <= OUTPUT_BUFFER_SIZE / 2) {
+    for (Uint32 i = 0; i < packets; i++) {
+      const Uint32 size = workload.packet_sizes[cursor.packet + i];
+      queue_packet(workload.data + cursor.offset, size);
+      cursor.offset += size;
+    }
+    stats.frames_sent++;
+    probe_pending = latency_probe;
+    queued = 1;
+  } else {
+    for (Uint32 i = 0; i < packets; i++) {
+      cursor.offset += workload.packet_sizes[cursor.packet + i];
+    }
+    stats.frames_dropped++;
+  }
+  cursor.packet += packets;
+
+  if (++cursor.frame == workload.frame_count) {
+    cursor = loop_start;
+  }
+  return queued;
+}
+
+// Write a probe once everything queued before it has been written, stamped right before the
+// write so that the time it waits in the output buffer isn't counted
+static void write_probe(const int fd) {
+  Uint8 probe[LATENCY_PROBE_SIZE] = {LATENCY_PROBE_COMMAND};
+  Uint8 encoded[LATENCY_PROBE_SIZE * 2 + 1];
+
+  const Uint64 now = SDL_GetPerformanceCounter();
+  for (int i = 1; i < LATENCY_PROBE_SIZE; i++) {
+    probe[i] = (Uint8)(now >> (8 * (i - 1)));
+  }
+  const size_t size = workload_encode_slip(probe, sizeof(probe), encoded);
+  if (write(fd, encoded, size) == (ssize_t)size) {
+    stats.bytes_sent += size;
+  }
+  probe_pending = 0;
+}
+
+// Show the pressed keys right away like the M8 would, so input latency can be measured
+static void echo_input(const Uint8 input) {
+  static const char hex[] = "0123456789ABCDEF";
+  const Uint8 joypad[3] = {0xFB, input, 0};
+
+  queue_packet(joypad, sizeof(joypad));
+  // Input state as two hex digits in the top right corner
+  for (int i = 0; i < 2; i++) {
+    const int x = 304 + i * 8;
+    const Uint8 character[12] = {0xFD, hex[(input >> (4 - i * 4)) & 0x0F], x & 0xFF, x >> 8, 0, 0,
+                                 0xFF, 0xFF, 0xFF, 0, 0, 0};
+    queue_packet(character, sizeof(character));
+  }
+}
+
+static void execute_command(void) {
+  switch (command) {
+  case 'E':
+  case 'R':
+    // Start over with a full redraw
+    display_enabled = 1;
+    reset_output();
+    SDL_zero(cursor);
+    break;
+  case 'D':
+    display_enabled = 0;
+    reset_output();
+    SDL_Log("Display disabled");
+    break;
+  case 'X':
+    stats.pings++;
+    break;
+  case 'C':
+    stats.inputs++;
+    if (display_enabled) {
+      echo_input(arguments[0]);
+    }
+    break;
+  case 'K':
+    stats.keyjazz++;
+    break;
+  default:
+    break;
+  }
+}
+
+static void parse_commands(const Uint8 *data, const ssize_t size) {
+  for (ssize_t i = 0; i < size; i++) {
+    if (arguments_needed > 0) {
+      arguments[argument_count++] = data[i];
+      arguments_needed--;
+      // Note off is sent without a velocity
+      if (command == 'K' && argument_count == 1 && data[i] == 0xFF) {
+        arguments_needed = 0;
+      }
+      if (arguments_needed == 0) {
+        execute_command();
+      }
+      continue;
+    }
+
+    command = data[i];
+    argument_count = 0;
+    switch (command) {
+    case 'C':
+      arguments_needed = 1;
+      break;
+    case 'K':
+      arguments_needed = 2;
+      break;
+    case 'E':
+    case 'R':
+    case 'X':
+    case 'D':
+      execute_command();
+      break;
+    default:
+      SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM, "Unknown command 0x%02X", command);
+      break;
+    }
+  }
+}
+
+static void log_stats(const Uint64 now) {
+  const double seconds = (double)(now - stats.ticks_ns) / SDL_NS_PER_SECOND;
+
+  SDL_Log("%.1f frames/s, %.1f KiB/s, %llu frames dropped, %llu inputs, %llu keyjazz, %llu pings",
+          (double)stats.frames_sent / seconds, (double)stats.bytes_sent / seconds / 1024.0,
+          (unsigned long long)stats.frames_dropped, (unsigned long long)stats.inputs,
+          (unsigned long long)stats.keyjazz, (unsigned long long)stats.pings);
+  SDL_zero(stats);
+  stats.ticks_ns = now;
+}
+
+static void usage(void) {
+  fprintf(stderr, "usage: m8_simulator [--workload " WORKLOAD_NAMES " | --capture <file>] "
+                  "[--rate <frames/s>] [--link <path>] [--disconnect-after <seconds>] "
+                  "[--latency-probe]\n");
+}
+
+int main(int argc, char *argv[]) {
+  const char *workload_name = "song_scroll";
+  const char *capture_path = NULL;
+  const char *link_path = NULL;
+  int rate = DEFAULT_RATE;
+  int disconnect_after = 0;
+  pty_s pty = {-1, -1, ""};
+
+  for (int i = 1; i < argc; i++) {
+    if (SDL_strcmp(argv[i], "--workload") == 0 && i + 1 < argc) {
+      workload_name = argv[++i];
+    } else if (SDL_strcmp(argv[i], "--capture") == 0 && i + 1 < argc) {
+      capture_path = argv[++i];
+    } else if (SDL_strcmp(argv[i], "--rate") == 0 && i + 1 < argc) {
+      rate = SDL_atoi(argv[++i]);
+    } else if (SDL_strcmp(argv[i], "--link") == 0 && i + 1 < argc) {
+      link_path = argv[++i];
+    } else if (SDL_strcmp(argv[i], "--disconnect-after") == 0 && i + 1 < argc) {
+      disconnect_after = SDL_atoi(argv[++i]);
+    } else if (SDL_strcmp(argv[i], "--latency-probe") == 0) {
+      latency_probe = 1;
+    } else {
+      usage();
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (capture_path != NULL) {
+    workload.name = capture_path;
+    if (!workload_load_capture(&workload, capture_path) || workload.frame_count == 0) {
+      return EXIT_FAILURE;
+    }
+  } else if (!workload_generate(&workload, workload_name, WORKLOAD_FRAMES)) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unknown workload %s", workload_name);
+    usage();
+    return EXIT_FAILURE;
+  }
+  if (workload.frame_count > 1) {
+    loop_start.frame = 1;
+    loop_start.packet = workload.frame_packets[0];
+    for (size_t i = 0; i < loop_start.packet; i++) {
+      loop_start.offset += workload.packet_sizes[i];
+    }
+  }
+
+  signal(SIGINT, handle_signal);
+  signal(SIGTERM, handle_signal);
+
+  if (!open_pty(&pty, link_path)) {
+    return EXIT_FAILURE;
+  }
+
+  const Uint64 frame_interval_ns = rate > 0 ? SDL_NS_PER_SECOND / rate : 0;
+  Uint64 next_frame_ns = SDL_GetTicksNS();
+  Uint64 connected_ns = next_frame_ns;
+  Uint64 hung_up_ns = 0;
+  stats.ticks_ns = next_frame_ns;
+
+  while (!stop_requested) {
+    Uint64 now = SDL_GetTicksNS();
+
+    if (hung_up_ns != 0) {
+      if (now - hung_up_ns >= RECONNECT_DELAY_NS) {
+        if (!open_pty(&pty, link_path)) {
+          break;
+        }
+        hung_up_ns = 0;
+        connected_ns = now;
+      } else {
+        SDL_Delay(10);
+        continue;
+      }
+    } else if (disconnect_after > 0 && now - connected_ns >= (Uint64)disconnect_after * SDL_NS_PER_SECOND) {
+      SDL_Log("Hanging up %s", pty.slave_path);
+      close_pty(&pty);
+      display_enabled = 0;
+      reset_output();
+      hung_up_ns = now;
+      continue;
+    }
+
+    if (display_enabled) {
+      if (frame_interval_ns == 0) {
+        // As fast as m8c takes them
+        while (output_used - output_sent < OUTPUT_BUFFER_SIZE / 4 && queue_frame()) {
+        }
+      } else if (now >= next_frame_ns) {
+        queue_frame();
+        next_frame_ns += frame_interval_ns;
+        // Don't try to catch up after a stall
+        if (now > next_frame_ns + SDL_NS_PER_SECOND) {
+          next_frame_ns = now + frame_interval_ns;
+        }
+      }
+    } else {
+      next_frame_ns = now;
+    }
+
+    if (output_sent < output_used) {
+      const ssize_t written = write(pty.master_fd, output + output_sent, output_used - output_sent);
+      if (written > 0) {
+        output_sent += (size_t)written;
+        stats.bytes_sent += (Uint64)written;
+      }
+    }
+    if (probe_pending && output_sent == output_used) {
+      write_probe(pty.master_fd);
+    }
+
+    // Wait for commands, room in the terminal's buffer or the next frame
+    now = SDL_GetTicksNS();
+    int timeout_ms = 100;
+    if (display_enabled && frame_interval_ns > 0) {
+      timeout_ms = next_frame_ns > now ? (int)((next_frame_ns - now) / SDL_NS_PER_MS) : 0;
+    }
+    struct pollfd fd = {.fd = pty.master_fd,
+                        .events = POLLIN | (output_sent < output_used ? POLLOUT : 0)};
+    if (poll(&fd, 1, timeout_ms) > 0 && (fd.revents & POLLIN)) {
+      Uint8 buffer[READ_SIZE];
+      const ssize_t bytes_read = read(pty.master_fd, buffer, sizeof(buffer));
+      if (bytes_read > 0) {
+        parse_commands(buffer, bytes_read);
+      }
+    }
+
+    if (now - stats.ticks_ns >= STATS_INTERVAL_NS) {
+      log_stats(now);
+    }
+  }
+
+  close_pty(&pty);
+  if (link_path != NULL) {
+    unlink(link_path);
+  }
+  workload_free(&workload);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,360 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+/* Headless benchmark of the path from M8 display commands to a presented frame.
+
+   Synthetic or captured workloads are fed through process_command() and render_screen() with
+   SDL's dummy video driver and the software renderer, followed by a comparison of the two SLIP
+   decoders on the same data and a measurement of loading the embedded fonts. Results are printed
+   as JSON so that they can be compared between releases.
+
+   usage: m8c_bench [--workload full_redraw|song_scroll|scope] [--capture <file>]
+                    [--frames <count>] [--framebuffer] [--output <file>]
+
+   Without --workload or --capture, all synthetic workloads are run. */
+
+#include <SDL3/SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/SDL2_inprint.h"
+#include "../src/backends/slip.h"
+#include "../src/command.h"
+#include "../src/config.h"
+#include "../src/draw_batch.h"
+#include "../src/frame_pacing.h"
+#include "../src/render.h"
+#include "workloads.h"
+
+#define MAX_WORKLOADS 8
+#define DEFAULT_FRAMES 600
+
+// Read size of the serial backends, the SLIP decoders get the stream in chunks of this size
+#define SLIP_CHUNK_SIZE 1024
+#define SLIP_BENCH_BYTES (64 * 1024 * 1024)
+
+#define FONT_LOAD_ROUNDS 50
+
+typedef struct {
+  Uint64 commands;
+  Uint64 command_ns;
+  Uint64 draw_calls;
+  Uint64 *frame_ns;
+} result_s;
+
+static void run_workload(const workload_s *w, config_params_s *conf, result_s *result) {
+  const Uint8 *packet = w->data;
+  size_t packet_index = 0;
+
+  result->frame_ns = SDL_calloc(w->frame_count, sizeof(*result->frame_ns));
+  if (result->frame_ns == NULL) {
+    SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION, "Out of memory");
+    exit(EXIT_FAILURE);
+  }
+
+  renderer_clear_screen();
+  const Uint64 draw_calls_before = draw_batch_draw_calls();
+
+  for (size_t frame = 0; frame < w->frame_count; frame++) {
+    const Uint64 start = SDL_GetTicksNS();
+    for (Uint32 i = 0; i < w->frame_packets[frame]; i++) {
+      process_command(packet, w->packet_sizes[packet_index]);
+      packet += w->packet_sizes[packet_index++];
+    }
+    const Uint64 processed = SDL_GetTicksNS();
+    render_screen(conf);
+    const Uint64 end = SDL_GetTicksNS();
+
+    result->commands += w->frame_packets[frame];
+    result->command_ns += processed - start;
+    result->frame_ns[frame] = end - start;
+  }
+
+  result->draw_calls = draw_batch_draw_calls() - draw_calls_before;
+}
+
+static int compare_ns(const void *a, const void *b) {
+  const Uint64 x = *(const Uint64 *)a;
+  const Uint64 y = *(const Uint64 *)b;
+  return x < y ? -1 : x > y;
+}
+
+static double percentile_us(const Uint64 *sorted, size_t count, double p) {
+  if (count == 0) {
+    return 0;
+  }
+  return (double)sorted[(size_t)(p * (double)(count - 1))] / 1000.0;
+}
+
+// Workload names can be file paths
+static void print_json_string(FILE *out, const char *text) {
+  fputc('"', out);
+  for (; *text != '\0'; text++) {
+    if (*text == '"' || *text == '\\') {
+      fputc('\\', out);
+    }
+    if ((unsigned char)*text >= 0x20) {
+      fputc(*text, out);
+    }
+  }
+  fputc('"', out);
+}
+
+static void print_result(FILE *out, const workload_s *w, result_s *result, int last) {
+  const size_t frames = w->frame_count;
+  const double command_s = (double)result->command_ns / 1e9;
+
+  qsort(result->frame_ns, frames, sizeof(*result->frame_ns), compare_ns);
+
+  fprintf(out, "    {\n");
+  fprintf(out, "      \"name\": ");
+  print_json_string(out, w->name);
+  fprintf(out, ",\n");
+  fprintf(out, "      \"frames\": %zu,\n", frames);
+  fprintf(out, "      \"commands\": %llu,\n", (unsigned long long)result->commands);
+  fprintf(out, "      \"commands_per_second\": %.0f,\n",
+          command_s > 0 ? (double)result->commands / command_s : 0.0);
+  fprintf(out, "      \"ns_per_command\": %.1f,\n",
+          result->commands > 0 ? (double)result->command_ns / (double)result->commands : 0.0);
+  fprintf(out, "      \"draw_calls_per_frame\": %.2f,\n",
+          frames > 0 ? (double)result->draw_calls / (double)frames : 0.0);
+  fprintf(out,
+          "      \"frame_time_us\": {\"p50\": %.1f, \"p90\": %.1f, \"p99\": %.1f, "
+          "\"max\": %.1f}\n",
+          percentile_us(result->frame_ns, frames, 0.5),
+          percentile_us(result->frame_ns, frames, 0.9),
+          percentile_us(result->frame_ns, frames, 0.99),
+          percentile_us(result->frame_ns, frames, 1.0));
+  fprintf(out, "    }%s\n", last ? "" : ",");
+}
+
+static Uint64 slip_frames_received;
+static Uint64 slip_checksum;
+
+static int count_frame(uint8_t *data, uint32_t size) {
+  slip_frames_received++;
+  slip_checksum += size > 0 ? data[0] + data[size - 1] : 0;
+  return 1;
+}
+
+// SLIP encode all packets of the workloads into one stream
+static Uint8 *encode_slip(const workload_s *workloads, int count, size_t *stream_size) {
+  Uint8 *stream = NULL;
+  size_t capacity = 0;
+  size_t size = 0;
+
+  for (int i = 0; i < count; i++) {
+    const Uint8 *packet = workloads[i].data;
+    for (size_t p = 0; p < workloads[i].packet_count; p++) {
+      const Uint32 packet_size = workloads[i].packet_sizes[p];
+      if (size + packet_size * 2 + 1 > capacity) {
+        capacity = (size + packet_size * 2 + 1) * 2;
+        stream = SDL_realloc(stream, capacity);
+        if (stream == NULL) {
+          SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION, "Out of memory");
+          exit(EXIT_FAILURE);
+        }
+      }
+      size += workload_encode_slip(packet, packet_size, stream + size);
+      packet += packet_size;
+    }
+  }
+  *stream_size = size;
+  return stream;
+}
+
+// Decode the stream repeatedly, returns MB/s
+static double bench_slip_decoder(const Uint8 *stream, size_t size, int whole_buffers,
+                                 Uint64 *frames, Uint64 *checksum) {
+  static uint8_t frame_buffer[1024];
+  const slip_descriptor_s descriptor = {
+      .buf = frame_buffer, .buf_size = sizeof(frame_buffer), .recv_message = count_frame};
+  slip_handler_s slip;
+  const int passes = (int)SDL_max(1, SLIP_BENCH_BYTES / size);
+
+  slip_init(&slip, &descriptor);
+  slip_frames_received = 0;
+  slip_checksum = 0;
+
+  const Uint64 start = SDL_GetTicksNS();
+  for (int pass = 0; pass < passes; pass++) {
+    for (size_t offset = 0; offset < size; offset += SLIP_CHUNK_SIZE) {
+      const uint32_t chunk = (uint32_t)SDL_min(SLIP_CHUNK_SIZE, size - offset);
+      if (whole_buffers) {
+        slip_read_buffer(&slip, stream + offset, chunk);
+      } else {
+        for (uint32_t i = 0; i < chunk; i++) {
+          slip_read_byte(&slip, stream[offset + i]);
+        }
+      }
+    }
+  }
+  const Uint64 elapsed = SDL_GetTicksNS() - start;
+
+  *frames = slip_frames_received;
+  *checksum = slip_checksum;
+  return (double)size * passes / ((double)elapsed / 1e9) / (1024.0 * 1024.0);
+}
+
+static void print_slip_results(FILE *out, const workload_s *workloads, int count) {
+  size_t size;
+  Uint64 byte_frames, byte_checksum, buffer_frames, buffer_checksum;
+  Uint8 *stream = encode_slip(workloads, count, &size);
+
+  const double byte_mb_s = bench_slip_decoder(stream, size, 0, &byte_frames, &byte_checksum);
+  const double buffer_mb_s =
+      bench_slip_decoder(stream, size, 1, &buffer_frames, &buffer_checksum);
+  SDL_free(stream);
+
+  if (byte_frames != buffer_frames || byte_checksum != buffer_checksum) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SLIP decoders disagree: %llu vs %llu frames",
+                 (unsigned long long)byte_frames, (unsigned long long)buffer_frames);
+  }
+
+  fprintf(out, "  \"slip\": {\n");
+  fprintf(out, "    \"stream_bytes\": %zu,\n", size);
+  fprintf(out, "    \"read_byte_mb_per_second\": %.1f,\n", byte_mb_s);
+  fprintf(out, "    \"read_buffer_mb_per_second\": %.1f,\n", buffer_mb_s);
+  fprintf(out, "    \"decoders_match\": %s\n",
+          byte_frames == buffer_frames && byte_checksum == buffer_checksum ? "true" : "false");
+  fprintf(out, "  },\n");
+}
+
+// Unpacking the glyphs alone, and together with creating the textures like at startup
+static void print_font_results(FILE *out) {
+  SDL_Renderer *renderer = SDL_GetRendererFromTexture(inline_font_get_texture());
+  size_t count;
+  const struct inline_font *const *fonts = fonts_all(&count);
+  size_t glyph_bytes = 0, pixel_count = 0;
+  for (size_t i = 0; i < count; i++) {
+    glyph_bytes += (size_t)FONTS_GLYPH_COUNT * fonts[i]->height * fonts[i]->row_bytes;
+    pixel_count = SDL_max(pixel_count, (size_t)fonts[i]->width * fonts[i]->height);
+  }
+
+  Uint32 *pixels = SDL_malloc(pixel_count * sizeof(Uint32));
+  Uint64 start = SDL_GetTicksNS();
+  for (int round = 0; round < FONT_LOAD_ROUNDS && pixels != NULL; round++) {
+    for (size_t i = 0; i < count; i++) {
+      fonts_unpack(fonts[i], pixels, 0xFFFFFFFF, 0);
+    }
+  }
+  const Uint64 unpack_ns = SDL_GetTicksNS() - start;
+  SDL_free(pixels);
+
+  int loaded = renderer != NULL;
+  start = SDL_GetTicksNS();
+  for (int round = 0; round < FONT_LOAD_ROUNDS && loaded; round++) {
+    loaded = inline_fonts_load(renderer);
+  }
+  const Uint64 load_ns = SDL_GetTicksNS() - start;
+
+  fprintf(out, "  \"fonts\": {\n");
+  fprintf(out, "    \"count\": %zu,\n", count);
+  fprintf(out, "    \"glyph_bytes\": %zu,\n", glyph_bytes);
+  fprintf(out, "    \"unpack_us\": %.1f,\n", (double)unpack_ns / FONT_LOAD_ROUNDS / 1000.0);
+  fprintf(out, "    \"load_us\": %.1f,\n", (double)load_ns / FONT_LOAD_ROUNDS / 1000.0);
+  fprintf(out, "    \"loaded\": %s\n", loaded ? "true" : "false");
+  fprintf(out, "  }\n");
+}
+
+static void usage(void) {
+  fprintf(stderr, "usage: m8c_bench [--workload " WORKLOAD_NAMES "] [--capture <file>] "
+                  "[--frames <count>] [--framebuffer] [--output <file>]\n");
+}
+
+int main(int argc, char *argv[]) {
+  workload_s workloads[MAX_WORKLOADS] = {0};
+  int workload_count = 0;
+  const char *selected = NULL;
+  const char *output_path = NULL;
+  int frames = DEFAULT_FRAMES;
+  int framebuffer = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (SDL_strcmp(argv[i], "--workload") == 0 && i + 1 < argc) {
+      selected = argv[++i];
+    } else if (SDL_strcmp(argv[i], "--capture") == 0 && i + 1 < argc &&
+               workload_count < MAX_WORKLOADS - 1) {
+      workloads[workload_count].name = argv[++i];
+      if (!workload_load_capture(&workloads[workload_count], argv[i])) {
+        return EXIT_FAILURE;
+      }
+      workload_count++;
+    } else if (SDL_strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      frames = SDL_atoi(argv[++i]);
+      frames = SDL_max(frames, 1);
+    } else if (SDL_strcmp(argv[i], "--framebuffer") == 0) {
+      framebuffer = 1;
+    } else if (SDL_strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+      output_path = argv[++i];
+    } else {
+      usage();
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (selected != NULL) {
+    if (!workload_generate(&workloads[workload_count], selected, frames)) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unknown workload %s", selected);
+      usage();
+      return EXIT_FAILURE;
+    }
+    workload_count++;
+  } else if (workload_count == 0) {
+    for (int i = 0; workload_names[i] != NULL && workload_count < MAX_WORKLOADS; i++) {
+      workload_generate(&workloads[workload_count++], workload_names[i], frames);
+    }
+  }
+
+  // Keep the renderer's own logging out of the measurements
+  SDL_SetLogPriorities(SDL_LOG_PRIORITY_WARN);
+  SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+  SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+
+  config_params_s conf = config_initialize(NULL);
+  conf.framebuffer_renderer = framebuffer;
+  // Present every frame as soon as it's done
+  conf.frame_pacing = FRAME_PACING_LOW_LATENCY;
+  frame_pacing_initialize(&conf);
+
+  if (!renderer_initialize(&conf)) {
+    SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION, "Failed to initialize renderer");
+    return EXIT_FAILURE;
+  }
+
+  FILE *out = stdout;
+  if (output_path != NULL) {
+    out = fopen(output_path, "w");
+    if (out == NULL) {
+      SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open %s", output_path);
+      return EXIT_FAILURE;
+    }
+  }
+
+  fprintf(out, "{\n");
+  fprintf(out, "  \"version\": \"%s\",\n", M8C_VERSION);
+  fprintf(out, "  \"video_driver\": \"%s\",\n", SDL_GetCurrentVideoDriver());
+  fprintf(out, "  \"renderer\": \"%s\",\n", framebuffer ? "framebuffer" : "draw_batch");
+  fprintf(out, "  \"workloads\": [\n");
+  for (int i = 0; i < workload_count; i++) {
+    result_s result = {0};
+    run_workload(&workloads[i], &conf, &result);
+    print_result(out, &workloads[i], &result, i == workload_count - 1);
+    SDL_free(result.frame_ns);
+  }
+  fprintf(out, "  ],\n");
+
+  print_slip_results(out, workloads, workload_count);
+  print_font_results(out);
+  fprintf(out, "}\n");
+
+  if (out != stdout) {
+    fclose(out);
+  }
+  for (int i = 0; i < workload_count; i++) {
+    workload_free(&workloads[i]);
+  }
+  renderer_close();
+  SDL_Quit();
+  return EXIT_SUCCESS;
+}
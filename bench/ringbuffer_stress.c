@@ -0,0 +1,169 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+/* Two-thread stress test of the lock-free audio ring buffer.
+
+   A producer thread writes a byte sequence through a small ring while the main thread reads it
+   back, both choosing at random between the copying push/pop calls and the zero-copy region
+   calls, with random lengths so that transfers keep wrapping around the end of the buffer. Every
+   byte is a function of its position in the stream, so lost, repeated or reordered data is
+   detected. Exits with a non-zero status on the first mismatch.
+
+   usage: ringbuffer_stress [--bytes <count>] [--capacity <bytes>] */
+
+#include <SDL3/SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/backends/ringbuffer.h"
+
+#define DEFAULT_BYTES (16 * 1024 * 1024)
+// Not a power of two, the ring rounds it up
+#define DEFAULT_CAPACITY 3000
+#define MAX_TRANSFER 1500
+
+typedef struct {
+  RingBuffer *ring;
+  Uint64 total;
+  Uint64 push_calls;
+  Uint64 region_calls;
+} producer_s;
+
+// The byte at a stream position. Multiplying spreads the position over all the bits, so that
+// data that is off by a multiple of 256 bytes doesn't match.
+static Uint8 pattern(const Uint64 position) {
+  return (Uint8)((position * 2654435761u) >> 24);
+}
+
+static Uint32 random_length(Uint64 *state, const Uint64 remaining) {
+  const Uint32 length = 1 + (Uint32)SDL_rand_r(state, MAX_TRANSFER);
+  return (Uint32)SDL_min(length, remaining);
+}
+
+static int SDLCALL produce(void *data) {
+  producer_s *producer = data;
+  Uint64 state = 1;
+  Uint64 position = 0;
+  Uint8 chunk[MAX_TRANSFER];
+
+  while (position < producer->total) {
+    const Uint32 length = random_length(&state, producer->total - position);
+    Uint32 written;
+
+    if (SDL_rand_r(&state, 2) == 0) {
+      for (Uint32 i = 0; i < length; i++) {
+        chunk[i] = pattern(position + i);
+      }
+      written = ring_buffer_push(producer->ring, chunk, length);
+      producer->push_calls++;
+    } else {
+      Uint8 *region = ring_buffer_get_write_region(producer->ring, &written);
+      written = SDL_min(written, length);
+      for (Uint32 i = 0; i < written; i++) {
+        region[i] = pattern(position + i);
+      }
+      ring_buffer_commit_write(producer->ring, written);
+      producer->region_calls++;
+    }
+
+    position += written;
+    if (written == 0) {
+      // Full, let the consumer run
+      SDL_Delay(0);
+    }
+  }
+  return 0;
+}
+
+// Returns the number of bytes that didn't match the pattern
+static Uint32 check(const Uint8 *data, const Uint32 length, const Uint64 position) {
+  Uint32 errors = 0;
+  for (Uint32 i = 0; i < length; i++) {
+    errors += data[i] != pattern(position + i);
+  }
+  return errors;
+}
+
+static void usage(void) {
+  fprintf(stderr, "usage: ringbuffer_stress [--bytes <count>] [--capacity <bytes>]\n");
+}
+
+int main(int argc, char *argv[]) {
+  producer_s producer = {NULL, DEFAULT_BYTES, 0, 0};
+  Uint32 capacity = DEFAULT_CAPACITY;
+
+  for (int i = 1; i < argc; i++) {
+    if (SDL_strcmp(argv[i], "--bytes") == 0 && i + 1 < argc) {
+      producer.total = SDL_strtoull(argv[++i], NULL, 10);
+    } else if (SDL_strcmp(argv[i], "--capacity") == 0 && i + 1 < argc) {
+      capacity = (Uint32)SDL_max(SDL_atoi(argv[++i]), 1);
+    } else {
+      usage();
+      return EXIT_FAILURE;
+    }
+  }
+
+  producer.ring = ring_buffer_create(capacity);
+  if (producer.ring == NULL) {
+    SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create the ring buffer");
+    return EXIT_FAILURE;
+  }
+
+  SDL_Thread *thread = SDL_CreateThread(produce, "producer", &producer);
+  if (thread == NULL) {
+    SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create thread: %s", SDL_GetError());
+    ring_buffer_free(producer.ring);
+    return EXIT_FAILURE;
+  }
+
+  Uint64 state = 2;
+  Uint64 position = 0;
+  Uint64 pop_calls = 0, region_calls = 0;
+  Uint32 errors = 0;
+  Uint8 chunk[MAX_TRANSFER];
+  const Uint64 start_ns = SDL_GetTicksNS();
+
+  while (position < producer.total && errors == 0) {
+    const Uint32 length = random_length(&state, producer.total - position);
+    Uint32 read;
+
+    if (SDL_rand_r(&state, 2) == 0) {
+      read = ring_buffer_pop(producer.ring, chunk, length);
+      errors = check(chunk, read, position);
+      pop_calls++;
+    } else {
+      const Uint8 *region = ring_buffer_get_read_region(producer.ring, &read);
+      read = SDL_min(read, length);
+      errors = check(region, read, position);
+      ring_buffer_commit_read(producer.ring, read);
+      region_calls++;
+    }
+
+    if (errors == 0) {
+      position += read;
+    }
+    if (read == 0) {
+      // Empty, let the producer run
+      SDL_Delay(0);
+    }
+  }
+
+  if (errors > 0) {
+    // Not waiting for the producer, it keeps trying to fill the ring that is no longer read
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Sequence broken near byte %llu",
+                 (unsigned long long)position);
+    return EXIT_FAILURE;
+  }
+
+  SDL_WaitThread(thread, NULL);
+  const double seconds = (double)(SDL_GetTicksNS() - start_ns) / SDL_NS_PER_SECOND;
+  const int empty = ring_buffer_empty(producer.ring) != 0;
+  SDL_Log("%llu bytes through a %u byte ring in %.2f s (%.0f MB/s), producer %llu pushes and "
+          "%llu regions, consumer %llu pops and %llu regions%s",
+          (unsigned long long)position, producer.ring->max_size, seconds,
+          (double)position / seconds / 1e6, (unsigned long long)producer.push_calls,
+          (unsigned long long)producer.region_calls, (unsigned long long)pop_calls,
+          (unsigned long long)region_calls, empty ? "" : ", ring not empty at the end");
+  ring_buffer_free(producer.ring);
+  return empty ? EXIT_SUCCESS : EXIT_FAILURE;
+}
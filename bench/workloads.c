@@ -0,0 +1,248 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#include "workloads.h"
+
+#include <stdlib.h>
+
+#include "../src/backends/capture.h"
+#include "../src/backends/slip.h"
+#include "../src/command.h"
+
+// M8 model 01 screen with the small font: 40x24 characters in 8x10 pixel cells
+#define SCREEN_WIDTH 320
+#define SCREEN_HEIGHT 240
+#define COLUMNS 40
+#define ROWS 24
+#define CELL_WIDTH 8
+#define CELL_HEIGHT 10
+#define WAVEFORM_MAX_HEIGHT 24
+
+// Captured frames are grouped into frames of this length
+#define CAPTURE_FRAME_US 16667
+
+const char *const workload_names[] = {"full_redraw", "song_scroll", "scope", NULL};
+
+static const struct color palette[] = {
+    {0xFF, 0xFF, 0xFF}, {0x00, 0xFF, 0xFF}, {0x60, 0x60, 0x8E}, {0xFF, 0x30, 0x70},
+    {0x32, 0xEC, 0x20}, {0xE0, 0x80, 0x00}, {0x80, 0x80, 0x80}, {0x00, 0x00, 0xFF},
+};
+static const struct color black = {0, 0, 0};
+
+static void *grow(void *array, size_t *capacity, const size_t needed, const size_t item_size) {
+  if (needed <= *capacity) {
+    return array;
+  }
+  size_t new_capacity = *capacity > 0 ? *capacity : 1024;
+  while (new_capacity < needed) {
+    new_capacity *= 2;
+  }
+  array = SDL_realloc(array, new_capacity * item_size);
+  if (array == NULL) {
+    SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION, "Out of memory");
+    exit(EXIT_FAILURE);
+  }
+  *capacity = new_capacity;
+  return array;
+}
+
+static void add_packet(workload_s *w, const Uint8 *packet, const Uint32 size) {
+  w->data = grow(w->data, &w->data_capacity, w->data_size + size, 1);
+  SDL_memcpy(w->data + w->data_size, packet, size);
+  w->data_size += size;
+
+  w->packet_sizes =
+      grow(w->packet_sizes, &w->packet_capacity, w->packet_count + 1, sizeof(*w->packet_sizes));
+  w->packet_sizes[w->packet_count++] = size;
+  w->current_frame_packets++;
+}
+
+static void end_frame(workload_s *w) {
+  w->frame_packets =
+      grow(w->frame_packets, &w->frame_capacity, w->frame_count + 1, sizeof(*w->frame_packets));
+  w->frame_packets[w->frame_count++] = w->current_frame_packets;
+  w->current_frame_packets = 0;
+}
+
+void workload_free(workload_s *w) {
+  SDL_free(w->data);
+  SDL_free(w->packet_sizes);
+  SDL_free(w->frame_packets);
+}
+
+static void put_rectangle(workload_s *w, int x, int y, int width, int height, struct color c) {
+  const Uint8 packet[12] = {0xFE, x & 0xFF, x >> 8, y & 0xFF, y >> 8, width & 0xFF, width >> 8,
+                            height & 0xFF, height >> 8, c.r, c.g, c.b};
+  add_packet(w, packet, sizeof(packet));
+}
+
+static void put_character(workload_s *w, char c, int column, int row, struct color fg,
+                          struct color bg) {
+  const int x = column * CELL_WIDTH;
+  const int y = row * CELL_HEIGHT;
+  const Uint8 packet[12] = {0xFD, (Uint8)c, x & 0xFF, x >> 8, y & 0xFF, y >> 8,
+                            fg.r, fg.g,     fg.b,     bg.r,   bg.g,     bg.b};
+  add_packet(w, packet, sizeof(packet));
+}
+
+static void put_text(workload_s *w, const char *text, int column, int row, struct color fg,
+                     struct color bg) {
+  for (; *text != '\0' && column < COLUMNS; text++, column++) {
+    put_character(w, *text, column, row, fg, bg);
+  }
+}
+
+static void put_waveform(workload_s *w, struct color c, const Uint8 *samples, int count) {
+  Uint8 packet[4 + 480];
+  packet[0] = 0xFC;
+  packet[1] = c.r;
+  packet[2] = c.g;
+  packet[3] = c.b;
+  SDL_memcpy(packet + 4, samples, count);
+  add_packet(w, packet, 4 + count);
+}
+
+// Production M8 with the small font, so the renderer is set up like with a real device
+static void put_system_info(workload_s *w) {
+  const Uint8 packet[6] = {0xFF, 0x02, 4, 0, 0, 0};
+  add_packet(w, packet, sizeof(packet));
+  end_frame(w);
+}
+
+// Every frame clears the screen and redraws all characters, like when switching views
+static void generate_full_redraw(workload_s *w, const int frames) {
+  put_system_info(w);
+  for (int frame = 0; frame < frames; frame++) {
+    put_rectangle(w, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, black);
+    for (int row = 0; row < ROWS; row++) {
+      for (int column = 0; column < COLUMNS; column++) {
+        const int i = row * COLUMNS + column + frame;
+        put_character(w, (char)(0x21 + i % 94), column, row,
+                      palette[i % SDL_arraysize(palette)], black);
+      }
+    }
+    end_frame(w);
+  }
+}
+
+// The song view scrolling by one row per frame while playing, with a highlighted cursor row
+static void generate_song_scroll(workload_s *w, const int frames) {
+  put_system_info(w);
+  put_rectangle(w, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, black);
+  put_text(w, "SONG", 1, 1, palette[0], black);
+  end_frame(w);
+
+  for (int frame = 0; frame < frames; frame++) {
+    for (int row = 0; row < 16; row++) {
+      const int song_row = (frame + row) & 0xFF;
+      const int cursor = row == 8;
+      const struct color bg = cursor ? palette[2] : black;
+      char line[COLUMNS + 1];
+      int length = SDL_snprintf(line, sizeof(line), "%02X ", song_row);
+
+      if (cursor) {
+        put_rectangle(w, 0, (row + 3) * CELL_HEIGHT, SCREEN_WIDTH, CELL_HEIGHT, bg);
+      }
+      for (int track = 0; track < 8; track++) {
+        const int chain = (song_row * 7 + track * 13) % 40;
+        if (chain < 24) {
+          length += SDL_snprintf(line + length, sizeof(line) - length, "%02X ", chain);
+        } else {
+          length += SDL_snprintf(line + length, sizeof(line) - length, "-- ");
+        }
+      }
+      put_text(w, line, 1, row + 3, palette[(song_row + 1) % 2], bg);
+    }
+    end_frame(w);
+  }
+}
+
+// A mostly static screen with an animated oscilloscope and level meters
+static void generate_scope(workload_s *w, const int frames) {
+  Uint8 samples[SCREEN_WIDTH];
+
+  put_system_info(w);
+  put_rectangle(w, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, black);
+  put_text(w, "PHRASE 00", 1, 3, palette[0], black);
+  end_frame(w);
+
+  for (int frame = 0; frame < frames; frame++) {
+    for (int i = 0; i < SCREEN_WIDTH; i++) {
+      const float phase = (float)(i * (1 + frame % 7)) * 0.05f + (float)frame * 0.3f;
+      samples[i] = (Uint8)(WAVEFORM_MAX_HEIGHT / 2 +
+                           SDL_sinf(phase) * (WAVEFORM_MAX_HEIGHT / 2 - 1) * SDL_cosf(phase * 0.1f));
+    }
+    put_waveform(w, palette[frame % SDL_arraysize(palette)], samples, SCREEN_WIDTH);
+
+    for (int meter = 0; meter < 2; meter++) {
+      const int level = (frame * (3 + meter)) % 60;
+      put_rectangle(w, 306 + meter * 6, 40, 4, 60 - level, black);
+      put_rectangle(w, 306 + meter * 6, 100 - level, 4, level, palette[4]);
+    }
+
+    char playhead[8];
+    SDL_snprintf(playhead, sizeof(playhead), "%02X", frame & 0xFF);
+    put_text(w, playhead, 30, 1, palette[1], black);
+    end_frame(w);
+  }
+}
+
+int workload_load_capture(workload_s *w, const char *path) {
+  capture_reader_s reader = {0};
+  Uint8 frame[1024];
+  Uint32 size;
+  Uint64 frame_end_us = CAPTURE_FRAME_US;
+  int result;
+
+  if (!capture_reader_open(&reader, path)) {
+    return 0;
+  }
+  while ((result = capture_reader_next(&reader, frame, sizeof(frame), &size)) == 1) {
+    while (reader.timestamp_us >= frame_end_us) {
+      // Idle periods don't produce frames
+      if (w->current_frame_packets > 0) {
+        end_frame(w);
+      }
+      frame_end_us += CAPTURE_FRAME_US;
+    }
+    if (size > 0) {
+      add_packet(w, frame, size);
+    }
+  }
+  if (w->current_frame_packets > 0) {
+    end_frame(w);
+  }
+  capture_reader_close(&reader);
+  return result == 0;
+}
+
+int workload_generate(workload_s *w, const char *name, const int frames) {
+  static void (*const generators[])(workload_s *w, int frames) = {
+      generate_full_redraw, generate_song_scroll, generate_scope};
+
+  for (int i = 0; workload_names[i] != NULL; i++) {
+    if (SDL_strcmp(name, workload_names[i]) == 0) {
+      w->name = workload_names[i];
+      generators[i](w, frames);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+size_t workload_encode_slip(const Uint8 *packet, const Uint32 size, Uint8 *out) {
+  size_t length = 0;
+  for (Uint32 i = 0; i < size; i++) {
+    if (packet[i] == SLIP_SPECIAL_BYTE_END) {
+      out[length++] = SLIP_SPECIAL_BYTE_ESC;
+      out[length++] = SLIP_ESCAPED_BYTE_END;
+    } else if (packet[i] == SLIP_SPECIAL_BYTE_ESC) {
+      out[length++] = SLIP_SPECIAL_BYTE_ESC;
+      out[length++] = SLIP_ESCAPED_BYTE_ESC;
+    } else {
+      out[length++] = packet[i];
+    }
+  }
+  out[length++] = SLIP_SPECIAL_BYTE_END;
+  return length;
+}
@@ -0,0 +1,41 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#ifndef WORKLOADS_H_
+#define WORKLOADS_H_
+
+#include <SDL3/SDL.h>
+
+// M8 display command streams for the benchmark and the simulator, split into screen frames
+
+#define WORKLOAD_NAMES "full_redraw|song_scroll|scope"
+
+typedef struct {
+  const char *name;
+  Uint8 *data; // Packets back to back
+  size_t data_size, data_capacity;
+  Uint32 *packet_sizes;
+  size_t packet_count, packet_capacity;
+  Uint32 *frame_packets; // Number of packets in each frame
+  size_t frame_count, frame_capacity;
+  Uint32 current_frame_packets;
+} workload_s;
+
+// Names of the synthetic workloads, NULL terminated
+extern const char *const workload_names[];
+
+// Generate a synthetic workload by name. The first frame sets up the M8 model and font, followed
+// by the given number of frames. Returns 0 for an unknown name.
+int workload_generate(workload_s *w, const char *name, int frames);
+
+// Load a capture file (see capture.h), grouping the captured packets into 1/60 s frames.
+// Returns 0 if the file can't be read completely.
+int workload_load_capture(workload_s *w, const char *path);
+
+void workload_free(workload_s *w);
+
+// SLIP encode a packet including the END byte. out must have room for size * 2 + 1 bytes.
+// Returns the encoded length.
+size_t workload_encode_slip(const Uint8 *packet, Uint32 size, Uint8 *out);
+
+#endif
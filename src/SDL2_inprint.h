@@ -7,10 +7,17 @@
 #include "fonts/fonts.h"
 #include <SDL3/SDL.h>
 
-extern void inline_font_initialize(const struct inline_font *font);
-extern void inline_font_close(void);
+// Unpack every embedded font and upload each into its own texture. Called when the renderer is
+// created and again after a render device reset. Returns 1 on success.
+extern int inline_fonts_load(SDL_Renderer *renderer);
+extern void inline_fonts_unload(void);
+
+// Select the inline font by its index in fonts_get(). Only switches textures, nothing is loaded.
+extern void inline_font_select(size_t index);
+extern size_t inline_font_get_current_index(void);
+// Texture of any loaded font, for drawing in a font other than the selected one
+extern SDL_Texture *inline_font_get_font_texture(size_t index);
 
-extern void inline_font_set_renderer(SDL_Renderer *renderer);
 extern void infont(SDL_Texture *font);
 extern void incolor1(const SDL_Color *color);
 extern void incolor(Uint32 color); /* Color must be in 0x00RRGGBB format ! */
@@ -18,5 +25,8 @@ extern void inprint(SDL_Renderer *dst, const char *str, Uint32 x, Uint32 y, Uint
                     Uint32 bgcolor);
 
 const struct inline_font *inline_font_get_current(void);
+SDL_Texture *inline_font_get_texture(void);
+// Get the location of a character in the font texture. Returns 0 if the font has no glyph for it.
+int inline_font_glyph_rect(int ascii_code, SDL_FRect *rect);
 
 #endif /* SDL2_inprint_h */
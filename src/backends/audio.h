@@ -4,6 +4,12 @@
 #define AUDIO_H
 
 int audio_initialize(const char *output_device_name, unsigned int audio_buffer_size);
+// Forward captured audio straight to the output with minimal buffering. Applies from the next
+// audio_initialize call.
+void audio_set_passthrough(unsigned int enabled);
+// Record the M8 audio to a file while audio is enabled, see audio_recorder.h
+int audio_record_start(const char *path);
+void audio_record_stop(void);
 void audio_toggle(const char *output_device_name, unsigned int audio_buffer_size);
 void audio_process(void);
 void audio_close(void);
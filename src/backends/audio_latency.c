@@ -0,0 +1,150 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#include "audio_latency.h"
+
+// Largest rate correction, +-0.5% is under 9 cents and covers any realistic clock drift
+#define MAX_CORRECTION 0.005f
+// PI gains on the fill error in seconds. Critically damped with a time constant of about 20 s,
+// slow enough that the fill sawtooth caused by callback sizes doesn't modulate the pitch.
+#define GAIN_P 0.1f
+#define GAIN_I 0.0025f
+// Time constant of the fill level smoothing
+#define SMOOTHING_SECONDS 0.5f
+// Don't touch the stream for changes smaller than this
+#define MIN_RATIO_STEP 0.000005f
+
+static unsigned int configured_target_ms = 0;
+
+// Controller state, only touched by the audio thread after audio_latency_start
+static unsigned int bytes_per_second = 0;
+static unsigned int target_bytes = 0;
+static unsigned int resume_bytes = 0;
+static int buffering = 1;
+static float smoothed_fill = 0;
+static float integral = 0;
+static float applied_ratio = 1.0f;
+static Uint64 last_update_ns = 0;
+
+// Published for other threads
+static SDL_AtomicInt stat_active;
+static SDL_AtomicInt stat_fill_bytes;
+static SDL_AtomicInt stat_latency_us;
+static SDL_AtomicInt stat_target_us;
+static SDL_AtomicInt stat_correction_ppm;
+static SDL_AtomicInt stat_underruns;
+static SDL_AtomicInt stat_measured_us;
+
+void audio_latency_set_target(unsigned int target_ms) { configured_target_ms = target_ms; }
+
+void audio_latency_start(unsigned int stream_bytes_per_second, unsigned int default_target_ms) {
+  const unsigned int target_ms = configured_target_ms > 0 ? configured_target_ms : default_target_ms;
+
+  bytes_per_second = stream_bytes_per_second;
+  target_bytes = (unsigned int)((Uint64)bytes_per_second * target_ms / 1000);
+  resume_bytes = target_bytes;
+  buffering = 1;
+  smoothed_fill = 0;
+  // The integral term holds the drift estimate, which depends on the device pair
+  integral = 0;
+  applied_ratio = 1.0f;
+  last_update_ns = 0;
+
+  SDL_SetAtomicInt(&stat_fill_bytes, 0);
+  SDL_SetAtomicInt(&stat_latency_us, 0);
+  SDL_SetAtomicInt(&stat_target_us, (int)(target_ms * 1000));
+  SDL_SetAtomicInt(&stat_correction_ppm, 0);
+  SDL_SetAtomicInt(&stat_underruns, 0);
+  SDL_SetAtomicInt(&stat_measured_us, -1);
+  SDL_SetAtomicInt(&stat_active, 1);
+
+  SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO, "Audio latency target %u ms (%u bytes)", target_ms,
+               target_bytes);
+}
+
+void audio_latency_stop(void) { SDL_SetAtomicInt(&stat_active, 0); }
+
+int audio_latency_ready(unsigned int fill_bytes) {
+  SDL_SetAtomicInt(&stat_fill_bytes, (int)fill_bytes);
+
+  if (!buffering) {
+    return 1;
+  }
+  if (fill_bytes < resume_bytes) {
+    return 0;
+  }
+
+  SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO, "Audio buffered (%u bytes), starting playback", fill_bytes);
+  buffering = 0;
+  smoothed_fill = (float)fill_bytes;
+  last_update_ns = SDL_GetTicksNS();
+  return 1;
+}
+
+int audio_latency_update(unsigned int fill_bytes, float *ratio) {
+  if (bytes_per_second == 0) {
+    return 0;
+  }
+
+  const Uint64 now = SDL_GetTicksNS();
+  // Clamp the step so that a stalled callback doesn't kick the integral
+  const float dt = SDL_min((float)(now - last_update_ns) / 1e9f, 0.1f);
+  last_update_ns = now;
+
+  smoothed_fill += (dt / (SMOOTHING_SECONDS + dt)) * ((float)fill_bytes - smoothed_fill);
+
+  // Positive error: too much audio buffered, consume it faster
+  const float error = (smoothed_fill - (float)target_bytes) / (float)bytes_per_second;
+  integral = SDL_clamp(integral + GAIN_I * error * dt, -MAX_CORRECTION, MAX_CORRECTION);
+  const float correction = SDL_clamp(GAIN_P * error + integral, -MAX_CORRECTION, MAX_CORRECTION);
+
+  SDL_SetAtomicInt(&stat_latency_us, (int)(smoothed_fill * 1e6f / (float)bytes_per_second));
+  SDL_SetAtomicInt(&stat_correction_ppm, (int)(correction * 1e6f));
+
+  const float new_ratio = 1.0f + correction;
+  if (SDL_fabsf(new_ratio - applied_ratio) < MIN_RATIO_STEP) {
+    return 0;
+  }
+  applied_ratio = new_ratio;
+  *ratio = new_ratio;
+  return 1;
+}
+
+void audio_latency_underrun(void) {
+  SDL_AddAtomicInt(&stat_underruns, 1);
+  // Rebuffer only halfway; the controller brings the fill back up to the target without
+  // another gap
+  buffering = 1;
+  resume_bytes = target_bytes / 2;
+}
+
+void audio_latency_measured(float latency_ms) {
+  SDL_SetAtomicInt(&stat_measured_us, (int)(latency_ms * 1000.0f));
+}
+
+void audio_latency_get_stats(audio_latency_stats_s *stats) {
+  stats->active = SDL_GetAtomicInt(&stat_active);
+  stats->fill_bytes = SDL_GetAtomicInt(&stat_fill_bytes);
+  stats->latency_ms = (float)SDL_GetAtomicInt(&stat_latency_us) / 1000.0f;
+  stats->target_ms = (float)SDL_GetAtomicInt(&stat_target_us) / 1000.0f;
+  stats->ratio = 1.0f + (float)SDL_GetAtomicInt(&stat_correction_ppm) / 1e6f;
+  stats->underruns = SDL_GetAtomicInt(&stat_underruns);
+  stats->measured_ms = (float)SDL_GetAtomicInt(&stat_measured_us) / 1000.0f;
+}
+
+void audio_latency_log_stats(void) {
+  audio_latency_stats_s stats;
+  audio_latency_get_stats(&stats);
+  if (!stats.active) {
+    return;
+  }
+  SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO,
+               "Audio latency %.1f ms (target %.1f ms), fill %u bytes, rate %+.0f ppm, %u "
+               "underruns",
+               stats.latency_ms, stats.target_ms, stats.fill_bytes, (stats.ratio - 1.0f) * 1e6f,
+               stats.underruns);
+  if (stats.measured_ms >= 0) {
+    SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO, "Audio capture-to-output latency %.1f ms",
+                 stats.measured_ms);
+  }
+}
@@ -0,0 +1,53 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#ifndef AUDIO_LATENCY_H
+#define AUDIO_LATENCY_H
+
+#include <SDL3/SDL.h>
+
+// Keeps the amount of M8 audio buffered on the host at a target level. The M8 and the output
+// device run on separate clocks, so without correction the buffer slowly grows (creeping latency)
+// or drains (periodic dropouts). The controller measures the fill level on every audio callback
+// and nudges the stream's frequency ratio by at most a few cents to hold it.
+
+typedef struct audio_latency_stats_s {
+  unsigned int active;       // A stream is being controlled
+  unsigned int fill_bytes;   // Latest measured buffer fill
+  float latency_ms;          // Smoothed buffer fill as time
+  float target_ms;
+  float ratio;               // Frequency ratio applied to the stream, 1.0 = no correction
+  unsigned int underruns;
+  float measured_ms;         // Measured capture-to-output latency, negative if not measured
+} audio_latency_stats_s;
+
+// Set the target buffer fill from the config, 0 uses the backend default. Applies from the next
+// audio_latency_start call.
+void audio_latency_set_target(unsigned int target_ms);
+
+// Start controlling a stream that buffers bytes_per_second of audio. Playback waits until the
+// target fill has been reached.
+void audio_latency_start(unsigned int bytes_per_second, unsigned int default_target_ms);
+void audio_latency_stop(void);
+
+// Called from the audio callback with the current fill. Returns 0 while (re)buffering, when the
+// callback should output silence instead of consuming buffered audio.
+int audio_latency_ready(unsigned int fill_bytes);
+
+// Called from the audio callback after audio_latency_ready. Returns 1 and sets ratio when the
+// stream's frequency ratio should be changed.
+int audio_latency_update(unsigned int fill_bytes, float *ratio);
+
+// Called from the audio callback when the buffer ran dry. Playback resumes after rebuffering.
+void audio_latency_underrun(void);
+
+// Report a measured capture-to-output latency. Safe to call from any thread.
+void audio_latency_measured(float latency_ms);
+
+// Safe to call from any thread
+void audio_latency_get_stats(audio_latency_stats_s *stats);
+
+// Log the current stats, called periodically
+void audio_latency_log_stats(void);
+
+#endif
@@ -2,6 +2,9 @@
 #include "SDL3/SDL_error.h"
 #ifdef USE_LIBUSB
 
+#include "../trace.h"
+#include "audio_latency.h"
+#include "audio_recorder.h"
 #include "m8.h"
 #include "ringbuffer.h"
 #include <SDL3/SDL.h>
@@ -10,6 +13,7 @@
 
 #define EP_ISO_IN 0x85
 #define IFACE_NUM 4
+#define M8_PID_MULTICHANNEL 0x048b
 
 #define NUM_TRANSFERS 64
 #define PACKET_SIZE 180
@@ -20,74 +24,76 @@ extern libusb_device_handle *devh;
 SDL_AudioStream *sdl_audio_stream = NULL;
 int audio_initialized = 0;
 RingBuffer *audio_buffer = NULL;
-static uint8_t *audio_callback_buffer = NULL;
-static size_t audio_callback_buffer_size = 0;
-static int audio_prebuffer_filled = 0;
-#define PREBUFFER_SIZE (8 * 1024)  // Wait for 8KB before starting playback
-
-static void audio_callback(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount) {
-  (void)userdata;  // Suppress unused parameter warning
-  (void)additional_amount;  // Suppress unused parameter warning
-  
-  // Reallocate callback buffer if needed
-  if (audio_callback_buffer_size < (size_t)total_amount) {
-    audio_callback_buffer = SDL_realloc(audio_callback_buffer, total_amount);
-    if (audio_callback_buffer == NULL) {
+static uint8_t *silence_buffer = NULL;
+static size_t silence_buffer_size = 0;
+#define AUDIO_FRAME_SIZE 4             // 16-bit stereo
+#define AUDIO_BYTES_PER_SECOND (44100 * AUDIO_FRAME_SIZE)
+#define DEFAULT_TARGET_LATENCY_MS 46   // About 8 KB buffered
+
+static void put_silence(SDL_AudioStream *stream, int amount) {
+  if (silence_buffer_size < (size_t)amount) {
+    uint8_t *buffer = SDL_realloc(silence_buffer, amount);
+    if (buffer == NULL) {
       SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate audio buffer");
       return;
     }
-    audio_callback_buffer_size = (size_t)total_amount;
+    SDL_memset(buffer, 0, amount);
+    silence_buffer = buffer;
+    silence_buffer_size = (size_t)amount;
   }
+  if (!SDL_PutAudioStreamData(stream, silence_buffer, amount)) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to put audio stream data: %s", SDL_GetError());
+  }
+}
 
-  // Try to get audio data from ring buffer
-  uint32_t available_bytes = audio_buffer->size;
-  
-  // Check if we have enough data for initial buffering
-  if (!audio_prebuffer_filled && available_bytes < PREBUFFER_SIZE) {
-    // Not enough data yet, output silence and wait
-    SDL_memset(audio_callback_buffer, 0, total_amount);
-    if(!SDL_PutAudioStreamData(stream, audio_callback_buffer, total_amount)) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to put audio stream data: %s", SDL_GetError());
-    }
+static void audio_callback(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount) {
+  (void)userdata;  // Suppress unused parameter warning
+  (void)additional_amount;  // Suppress unused parameter warning
+  const Uint64 trace = trace_begin();
+
+  // Only take whole sample frames so that silence padding can't shift the channels
+  const uint32_t available_bytes = ring_buffer_size(audio_buffer) & ~(uint32_t)(AUDIO_FRAME_SIZE - 1);
+
+  if (!audio_latency_ready(available_bytes)) {
+    // Not enough data buffered yet, output silence and wait
+    put_silence(stream, total_amount);
+    trace_end("audio_callback", trace);
     return;
   }
-  
-  // Mark prebuffer as filled once we have enough data
-  if (!audio_prebuffer_filled) {
-    audio_prebuffer_filled = 1;
-    SDL_LogDebug(SDL_LOG_CATEGORY_APPLICATION, "Audio prebuffer filled, starting playback");
+
+  // Compensate for the drift between the M8 and output device clocks
+  float ratio;
+  if (audio_latency_update(available_bytes, &ratio)) {
+    SDL_SetAudioStreamFrequencyRatio(stream, ratio);
   }
 
-  if (available_bytes >= (uint32_t)total_amount) {
-    // We have enough data, read it
-    uint32_t read_len = ring_buffer_pop(audio_buffer, audio_callback_buffer, total_amount);
-    if (read_len > 0) {
-      if(!SDL_PutAudioStreamData(stream, audio_callback_buffer, read_len)) {
-        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to put audio stream data: %s", SDL_GetError());
-      }
-    }
-  } else if (available_bytes > 0) {
-    // We have some data but not enough - read what we can and pad with silence
-    uint32_t read_len = ring_buffer_pop(audio_buffer, audio_callback_buffer, available_bytes);
-    SDL_memset(audio_callback_buffer + read_len, 0, total_amount - read_len);
-    if(!SDL_PutAudioStreamData(stream, audio_callback_buffer, total_amount)) {
+  // Hand the samples to SDL straight from the ring; this takes two regions when the data wraps
+  // around the end of the buffer
+  uint32_t remaining = SDL_min(available_bytes, (uint32_t)total_amount);
+  while (remaining > 0) {
+    uint32_t length;
+    const uint8_t *region = ring_buffer_get_read_region(audio_buffer, &length);
+    length = SDL_min(length, remaining);
+    if (!SDL_PutAudioStreamData(stream, region, (int)length)) {
       SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to put audio stream data: %s", SDL_GetError());
     }
-    SDL_LogDebug(SDL_LOG_CATEGORY_APPLICATION, "Partial buffer: %d/%d bytes", available_bytes, total_amount);
-  } else {
-    // No data available - put silence and reset prebuffer flag
-    SDL_memset(audio_callback_buffer, 0, total_amount);
-    if(!SDL_PutAudioStreamData(stream, audio_callback_buffer, total_amount)) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to put audio stream data: %s", SDL_GetError());
-    }
-    audio_prebuffer_filled = 0;  // Reset prebuffer to avoid continuous dropouts
-    SDL_LogDebug(SDL_LOG_CATEGORY_APPLICATION, "Buffer underflow! Resetting prebuffer");
+    ring_buffer_commit_read(audio_buffer, length);
+    remaining -= length;
   }
+
+  if (available_bytes < (uint32_t)total_amount) {
+    // Ran dry - pad with silence and rebuffer
+    put_silence(stream, total_amount - (int)available_bytes);
+    audio_latency_underrun();
+    SDL_LogDebug(SDL_LOG_CATEGORY_APPLICATION, "Buffer underflow: %u/%d bytes", available_bytes, total_amount);
+  }
+  trace_end("audio_callback", trace);
 }
 
 static void cb_xfr(struct libusb_transfer *xfr) {
   unsigned int i;
   static int error_count = 0;
+  const Uint64 trace = trace_begin();
 
   for (i = 0; i < (unsigned int)xfr->num_iso_packets; i++) {
     struct libusb_iso_packet_descriptor *pack = &xfr->iso_packet_desc[i];
@@ -105,9 +111,10 @@ static void cb_xfr(struct libusb_transfer *xfr) {
       const uint8_t *data = libusb_get_iso_packet_buffer_simple(xfr, i);
       if (sdl_audio_stream != 0 && audio_buffer != NULL) {
         uint32_t actual = ring_buffer_push(audio_buffer, data, pack->actual_length);
-        if (actual == (uint32_t)-1) {
+        if (actual < (uint32_t)pack->actual_length) {
           SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Buffer overflow!");
         }
+        audio_recorder_write(data, pack->actual_length);
       }
     }
   }
@@ -122,6 +129,7 @@ static void cb_xfr(struct libusb_transfer *xfr) {
     SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "error re-submitting URB: %s", libusb_error_name(submit_result));
     SDL_free(xfr->buffer);
   }
+  trace_end("audio_usb_transfer", trace);
 }
 
 static struct libusb_transfer *xfr[NUM_TRANSFERS];
@@ -205,6 +213,10 @@ int audio_initialize(const char *output_device_name, unsigned int audio_buffer_s
 
   // Create larger ring buffer for stable audio - about 1.5 seconds at 44.1kHz stereo 16-bit
   audio_buffer = ring_buffer_create(256 * 1024);
+  if (audio_buffer == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Failed to allocate audio ring buffer");
+    return -1;
+  }
 
   if (SDL_strcasecmp(SDL_GetCurrentAudioDriver(), "openslES") == 0 || output_device_name == NULL) {
     SDL_Log("Using default audio device");
@@ -217,9 +229,11 @@ int audio_initialize(const char *output_device_name, unsigned int audio_buffer_s
   if (sdl_audio_stream == NULL) {
     SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Failed to open audio stream: %s", SDL_GetError());
     ring_buffer_free(audio_buffer);
+    audio_buffer = NULL;
     return -1;
   }
 
+  audio_latency_start(AUDIO_BYTES_PER_SECOND, DEFAULT_TARGET_LATENCY_MS);
   SDL_ResumeAudioStreamDevice(sdl_audio_stream);
 
   // Good to go
@@ -230,7 +244,6 @@ int audio_initialize(const char *output_device_name, unsigned int audio_buffer_s
   }
 
   audio_initialized = 1;
-  audio_prebuffer_filled = 0;  // Reset prebuffer state
   SDL_Log("Successful init");
   return 1;
 
@@ -248,6 +261,8 @@ void audio_close() {
 
   SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO, "Closing audio");
 
+  audio_recorder_stop();
+
   int rc;
 
   for (int i = 0; i < NUM_TRANSFERS; i++) {
@@ -271,20 +286,48 @@ void audio_close() {
     SDL_DestroyAudioStream(sdl_audio_stream);
     sdl_audio_stream = 0;
   }
+  audio_latency_stop();
 
   SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Audio closed");
 
   ring_buffer_free(audio_buffer);
+  audio_buffer = NULL;
 
-  // Free callback buffer
-  if (audio_callback_buffer) {
-    SDL_free(audio_callback_buffer);
-    audio_callback_buffer = NULL;
-    audio_callback_buffer_size = 0;
+  // Free silence buffer
+  if (silence_buffer) {
+    SDL_free(silence_buffer);
+    silence_buffer = NULL;
+    silence_buffer_size = 0;
   }
 
   audio_initialized = 0;
-  audio_prebuffer_filled = 0;
+}
+
+int audio_record_start(const char *path) {
+  if (!audio_initialized) {
+    SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Audio must be enabled for recording");
+    return 0;
+  }
+  // The transfers above only carry the stereo mix. A stereo file from the multichannel model
+  // would look like a complete recording without being one.
+  struct libusb_device_descriptor desc;
+  if (libusb_get_device_descriptor(libusb_get_device(devh), &desc) == 0 &&
+      desc.idProduct == M8_PID_MULTICHANNEL) {
+    SDL_LogError(SDL_LOG_CATEGORY_AUDIO,
+                 "Recording the multichannel M8 needs the SDL audio backend, the libusb backend "
+                 "only receives the stereo mix");
+    return 0;
+  }
+  // The samples as they arrive from the device, before any rate correction
+  const SDL_AudioSpec spec = {SDL_AUDIO_S16LE, 2, 44100};
+  return audio_recorder_start(path, &spec);
+}
+
+void audio_record_stop(void) { audio_recorder_stop(); }
+
+void audio_set_passthrough(unsigned int enabled) {
+  // Isochronous transfers are already pushed to the output as they complete
+  (void)enabled;
 }
 
 void audio_toggle(const char *output_device_name, unsigned int audio_buffer_size) {
@@ -0,0 +1,256 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#include "audio_recorder.h"
+#include "ringbuffer.h"
+
+// The writer thread writes whole blocks of this size while recording
+#define WRITE_BLOCK_SIZE (64 * 1024)
+#define WRITER_INTERVAL_MS 20
+// How much audio the ring holds if the disk stalls
+#define RING_SECONDS 2
+#define WAV_HEADER_SIZE 4096
+// RIFF chunk sizes are 32 bits
+#define WAV_MAX_DATA_SIZE (0xFFFFFFFFu - WAV_HEADER_SIZE)
+
+#define WAVE_FORMAT_PCM 0x0001
+#define WAVE_FORMAT_IEEE_FLOAT 0x0003
+#define WAVE_FORMAT_EXTENSIBLE 0xFFFE
+
+static SDL_IOStream *record_io = NULL;
+static RingBuffer *record_ring = NULL;
+static SDL_Thread *writer_thread = NULL;
+static SDL_AudioSpec record_spec;
+static int record_wav = 0;
+static Uint64 start_time_ns = 0;
+// Written by the writer thread until it has finished
+static Uint64 data_size = 0;
+static int write_failed = 0;
+
+static SDL_AtomicInt accepting;      // Samples are being accepted from the audio threads
+static SDL_AtomicInt active_writers; // Audio threads inside audio_recorder_write
+static SDL_AtomicInt stop_requested;
+static SDL_AtomicInt overruns;
+static SDL_AtomicInt dropped_bytes;
+
+static int write_wav_header(void) {
+  Uint8 header[WAV_HEADER_SIZE];
+  SDL_zero(header);
+  SDL_IOStream *io = SDL_IOFromMem(header, sizeof(header));
+  if (io == NULL) {
+    return 0;
+  }
+
+  const Uint16 bits = SDL_AUDIO_BITSIZE(record_spec.format);
+  const Uint16 block_align = SDL_AUDIO_FRAMESIZE(record_spec);
+  const Uint16 tag = SDL_AUDIO_ISFLOAT(record_spec.format) ? WAVE_FORMAT_IEEE_FLOAT : WAVE_FORMAT_PCM;
+  // The plain format tags are only defined for up to two channels of 8 or 16 bit samples
+  const int extensible = record_spec.channels > 2 || bits > 16;
+  const Uint32 fmt_size = extensible ? 40 : 16;
+
+  SDL_WriteIO(io, "RIFF", 4);
+  SDL_WriteU32LE(io, (Uint32)(WAV_HEADER_SIZE - 8 + data_size));
+  SDL_WriteIO(io, "WAVEfmt ", 8);
+  SDL_WriteU32LE(io, fmt_size);
+  SDL_WriteU16LE(io, extensible ? WAVE_FORMAT_EXTENSIBLE : tag);
+  SDL_WriteU16LE(io, record_spec.channels);
+  SDL_WriteU32LE(io, record_spec.freq);
+  SDL_WriteU32LE(io, record_spec.freq * block_align);
+  SDL_WriteU16LE(io, block_align);
+  SDL_WriteU16LE(io, bits);
+  if (extensible) {
+    static const Uint8 guid_tail[12] = {0x00, 0x00, 0x10, 0x00, 0x80, 0x00,
+                                        0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71};
+    SDL_WriteU16LE(io, 22);
+    SDL_WriteU16LE(io, bits);
+    SDL_WriteU32LE(io, record_spec.channels == 2 ? 0x3 : 0); // Front left and right, or unassigned
+    SDL_WriteU32LE(io, tag);
+    SDL_WriteIO(io, guid_tail, sizeof(guid_tail));
+  }
+  // Pad the header so that the samples start on a block boundary
+  const Sint64 junk_size = WAV_HEADER_SIZE - SDL_TellIO(io) - 16;
+  SDL_WriteIO(io, "JUNK", 4);
+  SDL_WriteU32LE(io, (Uint32)junk_size);
+  SDL_SeekIO(io, junk_size, SDL_IO_SEEK_CUR);
+  SDL_WriteIO(io, "data", 4);
+  SDL_WriteU32LE(io, (Uint32)data_size);
+  SDL_CloseIO(io);
+
+  return SDL_SeekIO(record_io, 0, SDL_IO_SEEK_SET) == 0 &&
+         SDL_WriteIO(record_io, header, sizeof(header)) == sizeof(header);
+}
+
+static void write_samples(const Uint8 *data, Uint32 size) {
+  if (write_failed) {
+    return;
+  }
+
+  if (record_wav && data_size + size > WAV_MAX_DATA_SIZE) {
+    const Uint32 frame_size = SDL_AUDIO_FRAMESIZE(record_spec);
+    size = (Uint32)(WAV_MAX_DATA_SIZE - data_size) / frame_size * frame_size;
+    SDL_LogWarn(SDL_LOG_CATEGORY_AUDIO, "WAV file size limit reached, recording the rest is skipped");
+    write_failed = 1;
+  }
+  if (SDL_WriteIO(record_io, data, size) != size) {
+    SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Audio recording write failed: %s", SDL_GetError());
+    write_failed = 1;
+    return;
+  }
+  data_size += size;
+}
+
+static int SDLCALL writer_thread_func(void *data) {
+  (void)data;
+  int overruns_reported = 0;
+
+  for (;;) {
+    const int stopping = SDL_GetAtomicInt(&stop_requested);
+
+    // Whole blocks while recording, everything that is left when stopping
+    while (ring_buffer_size(record_ring) >= WRITE_BLOCK_SIZE ||
+           (stopping && !ring_buffer_empty(record_ring))) {
+      uint32_t length;
+      const uint8_t *region = ring_buffer_get_read_region(record_ring, &length);
+      length = SDL_min(length, WRITE_BLOCK_SIZE);
+      write_samples(region, length);
+      ring_buffer_commit_read(record_ring, length);
+    }
+    if (stopping) {
+      break;
+    }
+
+    const int overrun_count = SDL_GetAtomicInt(&overruns);
+    if (overrun_count != overruns_reported) {
+      SDL_LogWarn(SDL_LOG_CATEGORY_AUDIO, "Audio recording overrun, %d bytes dropped so far",
+                  SDL_GetAtomicInt(&dropped_bytes));
+      overruns_reported = overrun_count;
+    }
+    SDL_Delay(WRITER_INTERVAL_MS);
+  }
+  return 0;
+}
+
+int audio_recorder_start(const char *path, const SDL_AudioSpec *spec) {
+  audio_recorder_stop();
+
+  if (spec->format != SDL_AUDIO_S16LE && spec->format != SDL_AUDIO_S32LE &&
+      spec->format != SDL_AUDIO_F32LE) {
+    SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Unsupported audio recording format 0x%x", spec->format);
+    return 0;
+  }
+
+  record_spec = *spec;
+  const size_t path_length = SDL_strlen(path);
+  record_wav = !(path_length >= 4 && SDL_strcasecmp(path + path_length - 4, ".raw") == 0);
+
+  record_io = SDL_IOFromFile(path, "wb");
+  if (record_io == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Couldn't open recording file %s: %s", path,
+                 SDL_GetError());
+    return 0;
+  }
+  data_size = 0;
+  write_failed = 0;
+  if (record_wav && !write_wav_header()) {
+    SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Couldn't write recording file %s: %s", path,
+                 SDL_GetError());
+    SDL_CloseIO(record_io);
+    record_io = NULL;
+    return 0;
+  }
+
+  const Uint32 bytes_per_second = SDL_AUDIO_FRAMESIZE(record_spec) * record_spec.freq;
+  record_ring = ring_buffer_create(SDL_max(bytes_per_second * RING_SECONDS, 4 * WRITE_BLOCK_SIZE));
+  if (record_ring == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Couldn't allocate audio recording buffer");
+    SDL_CloseIO(record_io);
+    record_io = NULL;
+    return 0;
+  }
+
+  SDL_SetAtomicInt(&stop_requested, 0);
+  SDL_SetAtomicInt(&overruns, 0);
+  SDL_SetAtomicInt(&dropped_bytes, 0);
+  writer_thread = SDL_CreateThread(writer_thread_func, "audio recorder", NULL);
+  if (writer_thread == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Couldn't start audio recorder thread: %s",
+                 SDL_GetError());
+    ring_buffer_free(record_ring);
+    record_ring = NULL;
+    SDL_CloseIO(record_io);
+    record_io = NULL;
+    return 0;
+  }
+  start_time_ns = SDL_GetTicksNS();
+  SDL_SetAtomicInt(&accepting, 1);
+
+  SDL_Log("Recording audio to %s (%d channels, %d Hz, %d bit%s)", path, record_spec.channels,
+          record_spec.freq, SDL_AUDIO_BITSIZE(record_spec.format),
+          SDL_AUDIO_ISFLOAT(record_spec.format) ? " float" : "");
+  return 1;
+}
+
+void audio_recorder_write(const void *data, Uint32 size) {
+  if (!SDL_GetAtomicInt(&accepting)) {
+    return;
+  }
+
+  // audio_recorder_stop waits for this count to drop to zero before tearing down the ring
+  SDL_AddAtomicInt(&active_writers, 1);
+  if (SDL_GetAtomicInt(&accepting)) {
+    // Drop the whole write rather than part of it, so that sample frames stay intact
+    if (record_ring->max_size - ring_buffer_size(record_ring) < size) {
+      SDL_AddAtomicInt(&overruns, 1);
+      SDL_AddAtomicInt(&dropped_bytes, (int)size);
+    } else {
+      ring_buffer_push(record_ring, data, size);
+    }
+  }
+  SDL_AddAtomicInt(&active_writers, -1);
+}
+
+void audio_recorder_stop(void) {
+  if (writer_thread == NULL) {
+    return;
+  }
+
+  SDL_SetAtomicInt(&accepting, 0);
+  while (SDL_GetAtomicInt(&active_writers) > 0) {
+    SDL_Delay(1);
+  }
+  SDL_SetAtomicInt(&stop_requested, 1);
+  SDL_WaitThread(writer_thread, NULL);
+  writer_thread = NULL;
+
+  if (record_wav && !write_wav_header()) {
+    SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Couldn't finalize WAV header: %s", SDL_GetError());
+  }
+  SDL_CloseIO(record_io);
+  record_io = NULL;
+  ring_buffer_free(record_ring);
+  record_ring = NULL;
+
+  const Uint32 bytes_per_second = SDL_AUDIO_FRAMESIZE(record_spec) * record_spec.freq;
+  SDL_Log("Audio recording finished, %.1f seconds, %d overruns (%d bytes dropped)",
+          (double)data_size / bytes_per_second, SDL_GetAtomicInt(&overruns),
+          SDL_GetAtomicInt(&dropped_bytes));
+}
+
+int audio_recorder_is_recording(void) { return writer_thread != NULL; }
+
+Uint64 audio_recorder_start_time_ns(void) { return writer_thread != NULL ? start_time_ns : 0; }
+
+void audio_recorder_default_path(char *path, size_t size, const char *extension) {
+  SDL_Time now;
+  SDL_DateTime dt;
+  SDL_zero(dt);
+  if (SDL_GetCurrentTime(&now)) {
+    SDL_TimeToDateTime(now, &dt, true);
+  }
+
+  char *pref_path = SDL_GetPrefPath("", "m8c");
+  SDL_snprintf(path, size, "%sm8c-recording-%04d%02d%02d-%02d%02d%02d.%s",
+               pref_path ? pref_path : "", dt.year, dt.month, dt.day, dt.hour, dt.minute,
+               dt.second, extension);
+  SDL_free(pref_path);
+}
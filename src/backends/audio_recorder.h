@@ -0,0 +1,36 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#ifndef AUDIO_RECORDER_H
+#define AUDIO_RECORDER_H
+
+#include <SDL3/SDL.h>
+#include <stddef.h>
+
+// Records M8 audio to a WAV or raw PCM file. The audio threads hand samples over through a
+// lock-free ring and never touch the file; a writer thread does the I/O in large blocks.
+//
+// WAV files have a 4 KiB header (padded with a JUNK chunk) so that the sample data and every
+// block written after it are aligned to the file system's blocks. The header sizes are filled in
+// when recording stops. Raw files contain the samples only.
+
+// Start recording samples in spec, which must be little-endian S16, S32 or F32. Files
+// ending in ".raw" get raw PCM, anything else a WAV file. Returns 1 on success.
+int audio_recorder_start(const char *path, const SDL_AudioSpec *spec);
+
+// Queue samples for writing. Called by one audio thread at a time and never blocks: if the ring
+// is full the samples are dropped and counted as an overrun. Does nothing when not recording.
+void audio_recorder_write(const void *data, Uint32 size);
+
+// Stop accepting samples, write out the rest and finalize the file
+void audio_recorder_stop(void);
+
+int audio_recorder_is_recording(void);
+
+// SDL_GetTicksNS() when the first sample could be accepted, 0 when not recording
+Uint64 audio_recorder_start_time_ns(void);
+
+// Build a timestamped file name in the m8c preferences directory with the given extension
+void audio_recorder_default_path(char *path, size_t size, const char *extension);
+
+#endif
@@ -1,19 +1,40 @@
 // Copyright 2021 Jonne Kokkonen
 // Released under the MIT licence, https://opensource.org/licenses/MIT
 #ifndef USE_LIBUSB
+#include "../trace.h"
 #include "audio.h"
+#include "audio_latency.h"
+#include "audio_recorder.h"
 #include <SDL3/SDL.h>
 
 SDL_AudioStream *audio_stream_in, *audio_stream_out;
 
 static unsigned int audio_paused = 0;
 static unsigned int audio_initialized = 0;
+static unsigned int audio_passthrough = 0;
 static SDL_AudioSpec audio_spec_in = {SDL_AUDIO_S16LE, 2, 44100};
 
-static void SDLCALL audio_cb_out(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount) {
-  // suppress compiler warnings
-  (void)userdata;
-
+// Recording tap, a stream of its own bound to the M8 device
+static SDL_AudioStream *record_stream = NULL;
+static Uint8 *record_buffer = NULL;
+static int record_buffer_size = 0;
+
+// Pass-through state, written by the recording device thread
+static Uint8 *passthrough_buffer = NULL;
+static int passthrough_buffer_size = 0;
+static SDL_AtomicU32 passthrough_bytes_put; // Bytes put to the playback stream, wraps around
+
+// Latency marker: a position in the playback stream and the time the audio ending there was
+// captured. Published by setting marker_pending, cleared by the playback device thread when the
+// marker has been mixed.
+#define MARKER_INTERVAL_NS (250 * SDL_NS_PER_MS)
+static SDL_AtomicInt marker_pending;
+static Uint32 marker_position;
+static Uint64 marker_time_ns;
+static Uint64 marker_next_ns = 0;
+static float device_buffers_ms = 0; // Recording and playback device buffers, not visible in streams
+
+static void feed_output(SDL_AudioStream *stream, int additional_amount, int total_amount) {
   if (additional_amount <= 0) {
     return;
   }
@@ -27,6 +48,17 @@ static void SDLCALL audio_cb_out(void *userdata, SDL_AudioStream *stream, int ad
     return;
   }
 
+  // Let the output pad with silence until enough audio is buffered
+  if (!audio_latency_ready(bytes_available)) {
+    return;
+  }
+
+  // Compensate for the drift between the M8 and output device clocks
+  float ratio;
+  if (audio_latency_update(bytes_available, &ratio)) {
+    SDL_SetAudioStreamFrequencyRatio(audio_stream_in, ratio);
+  }
+
   // Decide how much to feed this time.
   int to_write_goal = additional_amount;
   if (total_amount > 0) {
@@ -71,8 +103,181 @@ static void SDLCALL audio_cb_out(void *userdata, SDL_AudioStream *stream, int ad
 
     to_write -= got;
   }
+
+  if (to_write_goal - to_write < additional_amount) {
+    audio_latency_underrun();
+  }
+}
+
+static void SDLCALL audio_cb_out(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount) {
+  // suppress compiler warnings
+  (void)userdata;
+
+  const Uint64 trace = trace_begin();
+  feed_output(stream, additional_amount, total_amount);
+  trace_end("audio_cb_out", trace);
+}
+
+// Pass-through mode: forward captured audio to the playback device's stream as soon as the
+// recording device delivers it. The playback device pulls directly from its bound stream, so there
+// is no pull callback and no prefill beyond what the latency controller asks for.
+static void forward_input(SDL_AudioStream *stream) {
+  const int bytes_available = SDL_GetAudioStreamAvailable(stream);
+  if (bytes_available <= 0) {
+    return;
+  }
+
+  if (passthrough_buffer_size < bytes_available) {
+    Uint8 *buffer = SDL_realloc(passthrough_buffer, bytes_available);
+    if (buffer == NULL) {
+      SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Failed to allocate audio pass-through buffer");
+      return;
+    }
+    passthrough_buffer = buffer;
+    passthrough_buffer_size = bytes_available;
+  }
+
+  const int got = SDL_GetAudioStreamData(stream, passthrough_buffer, bytes_available);
+  if (got <= 0) {
+    return;
+  }
+  if (!SDL_PutAudioStreamData(audio_stream_out, passthrough_buffer, got)) {
+    SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Error putting audio stream data: %s", SDL_GetError());
+    return;
+  }
+  const Uint32 bytes_put = SDL_GetAtomicU32(&passthrough_bytes_put) + (Uint32)got;
+  SDL_SetAtomicU32(&passthrough_bytes_put, bytes_put);
+
+  const Uint64 now = SDL_GetTicksNS();
+  if (now >= marker_next_ns && !SDL_GetAtomicInt(&marker_pending)) {
+    marker_position = bytes_put;
+    marker_time_ns = now;
+    marker_next_ns = now + MARKER_INTERVAL_NS;
+    SDL_SetAtomicInt(&marker_pending, 1);
+  }
+
+  const int queued = SDL_GetAudioStreamQueued(audio_stream_out);
+  float ratio;
+  if (queued >= 0 && audio_latency_ready(queued) && audio_latency_update(queued, &ratio)) {
+    SDL_SetAudioStreamFrequencyRatio(audio_stream_out, ratio);
+  }
+}
+
+static void SDLCALL audio_cb_in(void *userdata, SDL_AudioStream *stream, int additional_amount,
+                                int total_amount) {
+  (void)userdata;
+  (void)additional_amount;
+  (void)total_amount;
+
+  const Uint64 trace = trace_begin();
+  forward_input(stream);
+  trace_end("audio_cb_in", trace);
+}
+
+// Runs on the playback device thread right before a mixed buffer goes to the device. Detects when
+// the latency marker has been consumed from the playback stream.
+static void SDLCALL audio_postmix(void *userdata, const SDL_AudioSpec *spec, float *buffer,
+                                  int buflen) {
+  (void)userdata;
+  (void)spec;
+  (void)buffer;
+  (void)buflen;
+
+  if (!SDL_GetAtomicInt(&marker_pending)) {
+    return;
+  }
+  // Read the queue before the put count, so that a concurrent put can only delay detection
+  const int queued = SDL_GetAudioStreamQueued(audio_stream_out);
+  if (queued < 0) {
+    return;
+  }
+  const Uint32 consumed = SDL_GetAtomicU32(&passthrough_bytes_put) - (Uint32)queued;
+  if ((Sint32)(consumed - marker_position) < 0) {
+    return;
+  }
+
+  const float mixed_ms = (float)(SDL_GetTicksNS() - marker_time_ns) / (float)SDL_NS_PER_MS;
+  audio_latency_measured(mixed_ms + device_buffers_ms);
+  SDL_SetAtomicInt(&marker_pending, 0);
+}
+
+// Hands samples from the recording tap to the recorder. Runs on the recording device thread.
+static void SDLCALL audio_cb_record(void *userdata, SDL_AudioStream *stream, int additional_amount,
+                                    int total_amount) {
+  (void)userdata;
+  (void)additional_amount;
+  (void)total_amount;
+
+  const int bytes_available = SDL_GetAudioStreamAvailable(stream);
+  if (bytes_available <= 0) {
+    return;
+  }
+  if (record_buffer_size < bytes_available) {
+    Uint8 *buffer = SDL_realloc(record_buffer, bytes_available);
+    if (buffer == NULL) {
+      SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Failed to allocate audio recording buffer");
+      return;
+    }
+    record_buffer = buffer;
+    record_buffer_size = bytes_available;
+  }
+  const int got = SDL_GetAudioStreamData(stream, record_buffer, bytes_available);
+  if (got > 0) {
+    audio_recorder_write(record_buffer, (Uint32)got);
+  }
+}
+
+int audio_record_start(const char *path) {
+  if (!audio_initialized) {
+    SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Audio must be enabled for recording");
+    return 0;
+  }
+  audio_record_stop();
+
+  // Record every channel the M8 device delivers at its own rate, without the conversion to the
+  // output format or the latency controller's rate correction
+  const SDL_AudioDeviceID device = SDL_GetAudioStreamDevice(audio_stream_in);
+  SDL_AudioSpec spec;
+  if (!SDL_GetAudioDeviceFormat(device, &spec, NULL)) {
+    SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Couldn't get M8 audio format: %s", SDL_GetError());
+    return 0;
+  }
+  if (SDL_AUDIO_ISFLOAT(spec.format)) {
+    spec.format = SDL_AUDIO_F32LE;
+  } else if (SDL_AUDIO_BITSIZE(spec.format) > 16) {
+    spec.format = SDL_AUDIO_S32LE;
+  } else {
+    spec.format = SDL_AUDIO_S16LE;
+  }
+
+  if (!audio_recorder_start(path, &spec)) {
+    return 0;
+  }
+  record_stream = SDL_CreateAudioStream(&spec, &spec);
+  if (record_stream == NULL ||
+      !SDL_SetAudioStreamPutCallback(record_stream, audio_cb_record, NULL) ||
+      !SDL_BindAudioStream(device, record_stream)) {
+    SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Couldn't attach audio recorder: %s", SDL_GetError());
+    audio_record_stop();
+    return 0;
+  }
+  return 1;
+}
+
+void audio_record_stop(void) {
+  // Destroying the stream unbinds it, after which its callback no longer runs
+  if (record_stream != NULL) {
+    SDL_DestroyAudioStream(record_stream);
+    record_stream = NULL;
+  }
+  audio_recorder_stop();
+  SDL_free(record_buffer);
+  record_buffer = NULL;
+  record_buffer_size = 0;
 }
 
+void audio_set_passthrough(unsigned int enabled) { audio_passthrough = enabled; }
+
 void audio_toggle(const char *output_device_name, unsigned int audio_buffer_size) {
   if (!audio_initialized) {
     audio_initialize(output_device_name, audio_buffer_size);
@@ -157,7 +362,9 @@ int audio_initialize(const char *output_device_name, const unsigned int audio_bu
     SDL_SetHint(SDL_HINT_AUDIO_DEVICE_SAMPLE_FRAMES, audio_buffer_size_str);
   }
 
-  audio_stream_out = SDL_OpenAudioDeviceStream(output_device_id, NULL, audio_cb_out, NULL);
+  // In pass-through mode the playback stream is fed from the recording side instead
+  audio_stream_out = SDL_OpenAudioDeviceStream(output_device_id, NULL,
+                                               audio_passthrough ? NULL : audio_cb_out, NULL);
 
   SDL_AudioSpec audio_spec_out;
   int audio_out_buffer_size_real, audio_in_buffer_size_real = 0;
@@ -172,7 +379,8 @@ int audio_initialize(const char *output_device_name, const unsigned int audio_bu
               "Opening audio output: rate %dhz, buffer size: %d frames", audio_spec_out.freq,
               audio_out_buffer_size_real);
 
-  audio_stream_in = SDL_OpenAudioDeviceStream(m8_device_id, &audio_spec_in, NULL, NULL);
+  audio_stream_in = SDL_OpenAudioDeviceStream(m8_device_id, &audio_spec_in,
+                                              audio_passthrough ? audio_cb_in : NULL, NULL);
   if (!audio_stream_in) {
     SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Error opening audio input device: %s", SDL_GetError());
     SDL_DestroyAudioStream(audio_stream_out);
@@ -186,6 +394,30 @@ int audio_initialize(const char *output_device_name, const unsigned int audio_bu
 
 
 
+  const unsigned int out_buffer_ms =
+      audio_spec_out.freq > 0 ? 1000 * audio_out_buffer_size_real / audio_spec_out.freq : 0;
+  const unsigned int in_buffer_ms =
+      audio_spec_in.freq > 0 ? 1000 * audio_in_buffer_size_real / audio_spec_in.freq : 0;
+
+  if (audio_passthrough) {
+    // Queue only what evens out the recording device's delivery bursts
+    SDL_LogInfo(SDL_LOG_CATEGORY_AUDIO, "Audio pass-through enabled");
+    SDL_free(passthrough_buffer);
+    passthrough_buffer = NULL;
+    passthrough_buffer_size = 0;
+    SDL_SetAtomicU32(&passthrough_bytes_put, 0);
+    marker_next_ns = 0;
+    device_buffers_ms = (float)(in_buffer_ms + out_buffer_ms);
+    SDL_SetAtomicInt(&marker_pending, 0);
+    SDL_SetAudioPostmixCallback(SDL_GetAudioStreamDevice(audio_stream_out), audio_postmix, NULL);
+    audio_latency_start(SDL_AUDIO_FRAMESIZE(audio_spec_out) * audio_spec_out.freq,
+                        SDL_max(5, in_buffer_ms));
+  } else {
+    // By default keep two output device buffers' worth of M8 audio queued
+    audio_latency_start(SDL_AUDIO_FRAMESIZE(audio_spec_out) * audio_spec_out.freq,
+                        SDL_max(10, 2 * out_buffer_ms));
+  }
+
   SDL_ResumeAudioStreamDevice(audio_stream_out);
   SDL_ResumeAudioStreamDevice(audio_stream_in);
 
@@ -199,8 +431,13 @@ void audio_close(void) {
   if (!audio_initialized)
     return;
   SDL_Log("Closing audio devices");
+  audio_record_stop();
   SDL_DestroyAudioStream(audio_stream_in);
   SDL_DestroyAudioStream(audio_stream_out);
+  audio_latency_stop();
+  SDL_free(passthrough_buffer);
+  passthrough_buffer = NULL;
+  passthrough_buffer_size = 0;
   SDL_QuitSubSystem(SDL_INIT_AUDIO);
   audio_initialized = 0;
 }
@@ -0,0 +1,171 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#include "capture.h"
+
+static const char capture_magic[4] = {'M', '8', 'C', 'F'};
+
+// Frames are collected here so that the reader thread only writes to the file occasionally
+#define WRITE_BUFFER_SIZE 65536
+#define MAX_VARINT_SIZE 10
+
+static SDL_IOStream *capture_io = NULL;
+static Uint8 write_buffer[WRITE_BUFFER_SIZE];
+static size_t write_buffer_used = 0;
+static Uint64 last_frame_ns = 0;
+static Uint64 frames_captured = 0;
+
+static size_t put_varint(Uint8 *out, Uint64 value) {
+  size_t length = 0;
+  do {
+    Uint8 byte = value & 0x7F;
+    value >>= 7;
+    if (value != 0) {
+      byte |= 0x80;
+    }
+    out[length++] = byte;
+  } while (value != 0);
+  return length;
+}
+
+static int flush_write_buffer(void) {
+  if (write_buffer_used > 0 && SDL_WriteIO(capture_io, write_buffer, write_buffer_used) !=
+                                   write_buffer_used) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Capture write failed: %s", SDL_GetError());
+    write_buffer_used = 0;
+    return 0;
+  }
+  write_buffer_used = 0;
+  return 1;
+}
+
+static int write_bytes(const Uint8 *data, size_t size) {
+  if (write_buffer_used + size > WRITE_BUFFER_SIZE && !flush_write_buffer()) {
+    return 0;
+  }
+  if (size > WRITE_BUFFER_SIZE) {
+    return SDL_WriteIO(capture_io, data, size) == size;
+  }
+  SDL_memcpy(write_buffer + write_buffer_used, data, size);
+  write_buffer_used += size;
+  return 1;
+}
+
+int capture_start(const char *path) {
+  capture_stop();
+
+  capture_io = SDL_IOFromFile(path, "wb");
+  if (capture_io == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Couldn't open capture file %s: %s", path,
+                 SDL_GetError());
+    return 0;
+  }
+
+  const Uint8 header[8] = {capture_magic[0], capture_magic[1], capture_magic[2],
+                           capture_magic[3], CAPTURE_FORMAT_VERSION, 0, 0, 0};
+  write_buffer_used = 0;
+  write_bytes(header, sizeof(header));
+  last_frame_ns = SDL_GetTicksNS();
+  frames_captured = 0;
+
+  SDL_Log("Capturing display data to %s", path);
+  return 1;
+}
+
+void capture_frame(const uint8_t *data, uint32_t size) {
+  if (capture_io == NULL) {
+    return;
+  }
+
+  const Uint64 now = SDL_GetTicksNS();
+  Uint8 frame_header[MAX_VARINT_SIZE * 2];
+  size_t header_size = put_varint(frame_header, (now - last_frame_ns) / SDL_NS_PER_US);
+  header_size += put_varint(frame_header + header_size, size);
+  // Keep the remainder so that rounding errors don't accumulate
+  last_frame_ns = now - (now - last_frame_ns) % SDL_NS_PER_US;
+
+  if (!write_bytes(frame_header, header_size) || !write_bytes(data, size)) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Stopping capture");
+    SDL_CloseIO(capture_io);
+    capture_io = NULL;
+    return;
+  }
+  frames_captured++;
+}
+
+void capture_stop(void) {
+  if (capture_io == NULL) {
+    return;
+  }
+  flush_write_buffer();
+  SDL_CloseIO(capture_io);
+  capture_io = NULL;
+  SDL_Log("Capture finished, %llu frames", (unsigned long long)frames_captured);
+}
+
+// Returns 1 on success, 0 at a clean end of file and -1 on a truncated or invalid varint
+static int read_varint(SDL_IOStream *io, Uint64 *value) {
+  *value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    Uint8 byte;
+    if (!SDL_ReadU8(io, &byte)) {
+      return shift == 0 && SDL_GetIOStatus(io) == SDL_IO_STATUS_EOF ? 0 : -1;
+    }
+    *value |= (Uint64)(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      return 1;
+    }
+  }
+  return -1;
+}
+
+int capture_reader_open(capture_reader_s *reader, const char *path) {
+  Uint8 header[8];
+
+  reader->timestamp_us = 0;
+  reader->io = SDL_IOFromFile(path, "rb");
+  if (reader->io == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Couldn't open capture file %s: %s", path,
+                 SDL_GetError());
+    return 0;
+  }
+
+  if (SDL_ReadIO(reader->io, header, sizeof(header)) != sizeof(header) ||
+      SDL_memcmp(header, capture_magic, sizeof(capture_magic)) != 0) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "%s is not a capture file", path);
+    capture_reader_close(reader);
+    return 0;
+  }
+  if (header[4] != CAPTURE_FORMAT_VERSION) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Unsupported capture format version %d", header[4]);
+    capture_reader_close(reader);
+    return 0;
+  }
+  return 1;
+}
+
+int capture_reader_next(capture_reader_s *reader, uint8_t *buffer, uint32_t buffer_size,
+                        uint32_t *size) {
+  Uint64 delta_us, length;
+
+  const int result = read_varint(reader->io, &delta_us);
+  if (result <= 0) {
+    return result;
+  }
+  if (read_varint(reader->io, &length) <= 0 || length > buffer_size ||
+      SDL_ReadIO(reader->io, buffer, (size_t)length) != length) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Damaged frame in capture file");
+    return -1;
+  }
+
+  reader->timestamp_us += delta_us;
+  *size = (uint32_t)length;
+  return 1;
+}
+
+void capture_reader_close(capture_reader_s *reader) {
+  if (reader->io != NULL) {
+    SDL_CloseIO(reader->io);
+    reader->io = NULL;
+  }
+}
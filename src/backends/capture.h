@@ -0,0 +1,40 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#ifndef CAPTURE_H_
+#define CAPTURE_H_
+
+#include <SDL3/SDL.h>
+#include <stdint.h>
+
+/* Capture file format for the M8 display protocol stream, recorded after SLIP decoding.
+
+   header:  "M8CF" (4 bytes), format version (1 byte, currently 1), 3 reserved bytes
+   frames:  microseconds since the previous frame (LEB128 varint),
+            frame length (LEB128 varint),
+            frame bytes exactly as passed to recv_message
+
+   The first frame's time is relative to the start of the capture. */
+
+#define CAPTURE_FORMAT_VERSION 1
+
+// Start recording every received frame to a file. Returns 1 on success.
+int capture_start(const char *path);
+// Record a frame. Called by the device reader thread, does nothing if no capture is running.
+void capture_frame(const uint8_t *data, uint32_t size);
+void capture_stop(void);
+
+typedef struct {
+  SDL_IOStream *io;
+  Uint64 timestamp_us; // Time of the last frame read, relative to the start of the capture
+} capture_reader_s;
+
+// Open a capture file for reading. Returns 1 on success.
+int capture_reader_open(capture_reader_s *reader, const char *path);
+// Read the next frame into buffer. Returns 1 on success, 0 at the end of the file and -1 if the
+// file is damaged or the frame does not fit into the buffer.
+int capture_reader_next(capture_reader_s *reader, uint8_t *buffer, uint32_t buffer_size,
+                        uint32_t *size);
+void capture_reader_close(capture_reader_s *reader);
+
+#endif
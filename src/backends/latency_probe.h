@@ -0,0 +1,14 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#ifndef LATENCY_PROBE_H_
+#define LATENCY_PROBE_H_
+
+// Latency probe frames are sent by m8_simulator --latency-probe, never by a real M8. A probe is
+// a SLIP frame of the command byte followed by the SDL_GetPerformanceCounter() value taken just
+// before the frame was written, little-endian. The counter is system-wide, so the serial backend
+// can measure the time from the write to the frame being decoded against a clock of its own.
+#define LATENCY_PROBE_COMMAND 0xF0
+#define LATENCY_PROBE_SIZE 9
+
+#endif
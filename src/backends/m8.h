@@ -11,7 +11,7 @@ enum return_codes {
   DEVICE_FATAL_ERROR = -1
 };
 
-int m8_initialize(int verbose, const char *preferred_device);
+int m8_initialize(int verbose, const char *preferred_device, const config_params_s *conf);
 int m8_list_devices(void);
 int m8_reset_display(void);
 int m8_enable_display(unsigned char reset_display);
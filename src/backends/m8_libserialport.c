@@ -9,15 +9,28 @@
 #include <libserialport.h>
 #include <stdlib.h>
 #include <string.h>
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
 
 #include "../command.h"
 #include "../config.h"
+#include "../trace.h"
+#include "latency_probe.h"
 #include "m8.h"
 #include "queue.h"
 #include "slip.h"
 
 #define SERIAL_READ_SIZE 1024  // maximum amount of bytes to read from the serial in one pass
 #define SERIAL_READ_DELAY_MS 4 // delay between serial reads in milliseconds
+#define SERIAL_WAIT_TIMEOUT_MS 100 // Windows: how often a waiting reader checks for a stop request
+#define SERIAL_WRITE_TIMEOUT_MS 5
+#define SERIAL_STATS_INTERVAL_MS 5000
+#define SERIAL_LATENCY_SAMPLES 4096
 
 struct sp_port *m8_port = NULL;
 // allocate memory for serial buffers
@@ -30,38 +43,288 @@ SDL_Thread *serial_thread = NULL;
 
 // Structure to pass data to the thread
 typedef struct {
-  int should_stop; // Shared stop flag
+  int should_stop;  // Shared stop flag
+  int event_driven; // Sleep until the port has data instead of polling it
 } thread_params_s;
 
 thread_params_s thread_params;
 
+// Set by the reader thread when the port fails. The reader can't disconnect by itself, since that
+// joins the thread and frees the queue the main thread reads from.
+static SDL_AtomicInt port_lost;
+
+#ifndef _WIN32
+static int serial_fd = -1;
+static int wakeup_pipe[2] = {-1, -1}; // Written to when the reader needs to stop waiting
+// A preferred device that isn't a detected USB serial port is opened by path and used without
+// libserialport, which can't open devices like pseudo-terminals
+static int direct_fd = -1;
+#else
+static struct sp_event_set *serial_events = NULL;
+#endif
+
+// Time from a latency probe being written to the port to it being decoded, see latency_probe.h
+static struct {
+  Uint32 samples_us[SERIAL_LATENCY_SAMPLES];
+  unsigned int count;
+  Uint64 ticks;
+} latency_stats;
+
 // Helper function for error handling
 static int check(enum sp_return result);
 
+static int using_direct_device(void) {
+#ifndef _WIN32
+  return direct_fd != -1;
+#else
+  return 0;
+#endif
+}
+
+static int port_open(void) { return m8_port != NULL || using_direct_device(); }
+
+// Returns the number of bytes written or a negative value on error
+static int serial_write(const void *buf, const size_t count) {
+#ifndef _WIN32
+  if (using_direct_device()) {
+    size_t written = 0;
+    while (written < count) {
+      const ssize_t result = write(direct_fd, (const uint8_t *)buf + written, count - written);
+      if (result < 0) {
+        struct pollfd fd = {.fd = direct_fd, .events = POLLOUT};
+        if ((errno != EAGAIN && errno != EINTR) || poll(&fd, 1, SERIAL_WRITE_TIMEOUT_MS) <= 0) {
+          return -1;
+        }
+        continue;
+      }
+      written += (size_t)result;
+    }
+    return (int)written;
+  }
+#endif
+  return sp_blocking_write(m8_port, buf, count, SERIAL_WRITE_TIMEOUT_MS);
+}
+
+// Returns the number of bytes read, 0 if there was nothing to read or a negative value on error
+static int serial_read(uint8_t *buf, const size_t count) {
+#ifndef _WIN32
+  if (using_direct_device()) {
+    const ssize_t result = read(direct_fd, buf, count);
+    if (result < 0) {
+      return errno == EAGAIN || errno == EINTR ? 0 : -1;
+    }
+    return (int)result;
+  }
+#endif
+  return sp_nonblocking_read(m8_port, buf, count);
+}
+
+static void close_port(void) {
+#ifndef _WIN32
+  if (using_direct_device()) {
+    close(direct_fd);
+    direct_fd = -1;
+    return;
+  }
+#endif
+  sp_close(m8_port);
+  sp_free_port(m8_port);
+  m8_port = NULL;
+}
+
+#ifndef _WIN32
+// Open a serial device by path with the same settings as configure_serial_port()
+static int open_direct_device(const char *path, const int verbose) {
+  struct termios tio;
+  const int fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+
+  if (fd < 0) {
+    if (verbose) {
+      SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Cannot open %s: %s", path, strerror(errno));
+    }
+    return 0;
+  }
+  if (!isatty(fd) || tcgetattr(fd, &tio) != 0) {
+    if (verbose) {
+      SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "%s is not a serial device", path);
+    }
+    close(fd);
+    return 0;
+  }
+
+  // 115200 baud, 8 data bits, no parity, 1 stop bit, no flow control
+  cfmakeraw(&tio);
+  cfsetispeed(&tio, B115200);
+  cfsetospeed(&tio, B115200);
+  tio.c_cflag |= CLOCAL | CREAD;
+  tio.c_cflag &= ~(CSTOPB | CRTSCTS);
+  if (tcsetattr(fd, TCSANOW, &tio) != 0) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Cannot configure %s: %s", path, strerror(errno));
+    close(fd);
+    return 0;
+  }
+  tcflush(fd, TCIOFLUSH);
+
+  direct_fd = fd;
+  SDL_Log("Using %s without USB device detection", path);
+  return 1;
+}
+#endif
+
+static int compare_latency(const void *a, const void *b) {
+  const Uint32 x = *(const Uint32 *)a;
+  const Uint32 y = *(const Uint32 *)b;
+  return (x > y) - (x < y);
+}
+
+static void record_latency(Uint64 latency_ns) {
+  if (latency_stats.count < SERIAL_LATENCY_SAMPLES) {
+    latency_stats.samples_us[latency_stats.count++] = (Uint32)(latency_ns / 1000);
+  }
+
+  const Uint64 now = SDL_GetTicks();
+  if (now - latency_stats.ticks > SERIAL_STATS_INTERVAL_MS) {
+    Uint64 total = 0;
+    for (unsigned int i = 0; i < latency_stats.count; i++) {
+      total += latency_stats.samples_us[i];
+    }
+    SDL_qsort(latency_stats.samples_us, latency_stats.count, sizeof(Uint32), compare_latency);
+    SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM,
+                 "Serial (%s): write-to-queue latency avg %.0f us, p99 %u us over %u probes",
+                 thread_params.event_driven ? "event-driven" : "polling",
+                 (double)total / latency_stats.count,
+                 latency_stats.samples_us[latency_stats.count * 99 / 100], latency_stats.count);
+    latency_stats.count = 0;
+    latency_stats.ticks = now;
+  }
+}
+
+// Probes are only measured, the reserved queue storage is left uncommitted
+static int is_latency_probe(const uint8_t *data, const uint32_t size) {
+  if (size != LATENCY_PROBE_SIZE || data[0] != LATENCY_PROBE_COMMAND) {
+    return 0;
+  }
+  Uint64 sent = 0;
+  for (int i = LATENCY_PROBE_SIZE - 1; i > 0; i--) {
+    sent = sent << 8 | data[i];
+  }
+  const Uint64 now = SDL_GetPerformanceCounter();
+  if (now > sent) {
+    record_latency((Uint64)((double)(now - sent) * SDL_NS_PER_SECOND /
+                            (double)SDL_GetPerformanceFrequency()));
+  }
+  return 1;
+}
+
 static int send_message_to_queue(uint8_t *data, const uint32_t size) {
-  push_message(&queue, data, size);
+  if (is_latency_probe(data, size)) {
+    return 1;
+  }
+  if (data == slip_buffer) {
+    // No queue storage was available when the frame started, copy it in
+    push_message(&queue, data, size);
+  } else {
+    commit_message(&queue, size);
+  }
   return 1;
 }
 
+// Let the SLIP decoder write frames straight into the message queue
+static uint8_t *reserve_queue_storage(const uint32_t size) {
+  return reserve_message(&queue, size);
+}
+
+// Set up waiting on the port for the event-driven reader. Returns 0 if it isn't available.
+static int open_serial_wait(struct sp_port *port) {
+#ifndef _WIN32
+  if (using_direct_device()) {
+    serial_fd = direct_fd;
+  } else if (sp_get_port_handle(port, &serial_fd) != SP_OK) {
+    return 0;
+  }
+  if (pipe(wakeup_pipe) != 0) {
+    wakeup_pipe[0] = wakeup_pipe[1] = -1;
+    return 0;
+  }
+#else
+  if (sp_new_event_set(&serial_events) != SP_OK) {
+    return 0;
+  }
+  if (sp_add_port_events(serial_events, port, SP_EVENT_RX_READY) != SP_OK) {
+    sp_free_event_set(serial_events);
+    serial_events = NULL;
+    return 0;
+  }
+#endif
+  return 1;
+}
+
+static void close_serial_wait(void) {
+#ifndef _WIN32
+  if (wakeup_pipe[0] != -1) {
+    close(wakeup_pipe[0]);
+    close(wakeup_pipe[1]);
+    wakeup_pipe[0] = wakeup_pipe[1] = -1;
+  }
+  serial_fd = -1;
+#else
+  if (serial_events != NULL) {
+    sp_free_event_set(serial_events);
+    serial_events = NULL;
+  }
+#endif
+}
+
+// Interrupt a reader blocked in wait_for_serial_data()
+static void wake_serial_thread(void) {
+#ifndef _WIN32
+  if (wakeup_pipe[1] != -1) {
+    const char wake = 1;
+    if (write(wakeup_pipe[1], &wake, 1) != 1) {
+      SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Cannot wake up serial thread");
+    }
+  }
+#endif
+  // On Windows the reader notices the stop flag within SERIAL_WAIT_TIMEOUT_MS
+}
+
+// Block until the port has data. Returns 1 when there is data to read, 0 when woken up without
+// data and -1 if the port has gone away.
+static int wait_for_serial_data(void) {
+#ifndef _WIN32
+  struct pollfd fds[2] = {{.fd = serial_fd, .events = POLLIN},
+                          {.fd = wakeup_pipe[0], .events = POLLIN}};
+  if (poll(fds, 2, -1) < 0) {
+    return errno == EINTR ? 0 : -1;
+  }
+  if (fds[0].revents & (POLLERR | POLLHUP | POLLNVAL)) {
+    return -1;
+  }
+  return (fds[0].revents & POLLIN) != 0;
+#else
+  return sp_wait(serial_events, SERIAL_WAIT_TIMEOUT_MS) == SP_OK ? 1 : -1;
+#endif
+}
+
 static int disconnect() {
   SDL_Log("Disconnecting M8");
 
   // wait for the serial processing thread to finish
   thread_params.should_stop = 1;
+  wake_serial_thread();
   SDL_WaitThread(serial_thread, NULL);
+  close_serial_wait();
   destroy_queue(&queue);
 
   const unsigned char buf[1] = {'D'};
 
-  int result = sp_blocking_write(m8_port, buf, 1, 5);
+  int result = serial_write(buf, 1);
   if (result != 1) {
     SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Error sending disconnect, code %d", result);
     result = 0;
   }
 
-  sp_close(m8_port);
-  sp_free_port(m8_port);
-  m8_port = NULL;
+  close_port();
   return result;
 }
 
@@ -94,6 +357,14 @@ static int serial_port_connected() {
 
   int device_found = 0;
 
+#ifndef _WIN32
+  if (using_direct_device()) {
+    // Not in the port list, check that the other end hasn't hung up instead
+    struct pollfd fd = {.fd = direct_fd, .events = 0};
+    return poll(&fd, 1, 0) >= 0 && (fd.revents & (POLLHUP | POLLERR | POLLNVAL)) == 0;
+  }
+#endif
+
   struct sp_port **port_list;
 
   const enum sp_return result = sp_list_ports(&port_list);
@@ -117,26 +388,42 @@ static int serial_port_connected() {
 }
 
 static void process_received_bytes(const uint8_t *buffer, int bytes_read, slip_handler_s *slip) {
-  const uint8_t *cur = buffer;
-  const uint8_t *end = buffer + bytes_read;
-  while (cur < end) {
-    const int slip_result = slip_read_byte(slip, *cur++);
-    if (slip_result != SLIP_NO_ERROR) {
-      SDL_LogError(SDL_LOG_CATEGORY_ERROR, "SLIP error %d", slip_result);
-    }
+  const Uint64 trace = trace_begin();
+  const int slip_result = slip_read_buffer(slip, buffer, (uint32_t)bytes_read);
+  trace_end("slip_decode", trace);
+  if (slip_result != SLIP_NO_ERROR) {
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "SLIP error %d", slip_result);
   }
 }
 
 static int thread_process_serial_data(void *data) {
   const thread_params_s *thread_params = data;
 
+  latency_stats.count = 0;
+  latency_stats.ticks = SDL_GetTicks();
+  trace_name_thread("serial reader");
+
   while (!thread_params->should_stop) {
+    if (thread_params->event_driven) {
+      const int ready = wait_for_serial_data();
+      if (ready < 0) {
+        SDL_LogCritical(SDL_LOG_CATEGORY_ERROR, "Error waiting for serial data.");
+        SDL_SetAtomicInt(&port_lost, 1);
+        return 0;
+      }
+      if (ready == 0) {
+        continue; // Woken up to stop, or interrupted
+      }
+    }
+
     // attempt to read from serial port
-    const int bytes_read = sp_nonblocking_read(m8_port, serial_buffer, SERIAL_READ_SIZE);
+    const Uint64 trace_read = trace_begin();
+    const int bytes_read = serial_read(serial_buffer, SERIAL_READ_SIZE);
+    trace_end("serial_read", trace_read);
 
     if (bytes_read < 0) {
       SDL_LogCritical(SDL_LOG_CATEGORY_ERROR, "Error %d reading serial.", bytes_read);
-      disconnect();
+      SDL_SetAtomicInt(&port_lost, 1);
       return 0;
     }
 
@@ -144,7 +431,9 @@ static int thread_process_serial_data(void *data) {
       process_received_bytes(serial_buffer, bytes_read, &slip);
     }
 
-    SDL_Delay(SERIAL_READ_DELAY_MS);
+    if (!thread_params->event_driven) {
+      SDL_Delay(SERIAL_READ_DELAY_MS);
+    }
   }
   return 1;
 }
@@ -192,9 +481,19 @@ static int check(const enum sp_return result) {
 }
 
 // Extracted function for initializing threads and message queue
-static int initialize_serial_thread() {
+static int initialize_serial_thread(const int event_driven) {
 
   init_queue(&queue);
+
+  thread_params.should_stop = 0;
+  thread_params.event_driven = event_driven;
+  SDL_SetAtomicInt(&port_lost, 0);
+  if (event_driven && !open_serial_wait(m8_port)) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM, "Cannot wait for serial events, polling instead");
+    close_serial_wait();
+    thread_params.event_driven = 0;
+  }
+
   serial_thread = SDL_CreateThread(thread_process_serial_data, "SerialThread", &thread_params);
 
   if (!serial_thread) {
@@ -203,13 +502,11 @@ static int initialize_serial_thread() {
     return 0;
   }
 
-  thread_params.should_stop = 0;
-
   return 1;
 }
 
 // Extracted function for detecting and selecting the M8 device
-static int find_and_select_device(const char *preferred_device) {
+static int find_and_select_device(const char *preferred_device, const int verbose) {
   struct sp_port **port_list;
   const enum sp_return port_result = sp_list_ports(&port_list);
 
@@ -235,11 +532,27 @@ static int find_and_select_device(const char *preferred_device) {
   }
 
   sp_free_port_list(port_list);
+
+#ifndef _WIN32
+  // The preferred device wasn't detected, but it may still be usable by path
+  if (preferred_device != NULL &&
+      (m8_port == NULL || strcmp(sp_get_port_name(m8_port), preferred_device) != 0) &&
+      open_direct_device(preferred_device, verbose)) {
+    if (m8_port != NULL) {
+      sp_free_port(m8_port);
+      m8_port = NULL;
+    }
+    return 1;
+  }
+#else
+  (void)verbose;
+#endif
+
   return (m8_port != NULL);
 }
 
-int m8_initialize(const int verbose, const char *preferred_device) {
-  if (m8_port != NULL) {
+int m8_initialize(const int verbose, const char *preferred_device, const config_params_s *conf) {
+  if (port_open()) {
     // Port is already initialized
     return 1;
   }
@@ -249,6 +562,7 @@ int m8_initialize(const int verbose, const char *preferred_device) {
       .buf = slip_buffer,
       .buf_size = sizeof(slip_buffer),
       .recv_message = send_message_to_queue,
+      .get_buffer = reserve_queue_storage,
   };
   slip_init(&slip, &slip_descriptor);
 
@@ -257,7 +571,7 @@ int m8_initialize(const int verbose, const char *preferred_device) {
   }
 
   // Detect and select M8 device
-  if (!find_and_select_device(preferred_device)) {
+  if (!find_and_select_device(preferred_device, verbose)) {
     if (verbose) {
       SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Cannot find a M8");
     }
@@ -265,19 +579,19 @@ int m8_initialize(const int verbose, const char *preferred_device) {
   }
 
   // Configure serial port
-  if (!configure_serial_port(m8_port)) {
+  if (!using_direct_device() && !configure_serial_port(m8_port)) {
     return 0;
   }
 
   // Initialize message queue and threads
-  return initialize_serial_thread();
+  return initialize_serial_thread(conf->serial_event_driven);
 }
 
 static int send_ping() {
   SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Sending ping");
   const unsigned char buf[1] = {'X'};
   const size_t nbytes = 1;
-  const int result = sp_blocking_write(m8_port, buf, nbytes, 5);
+  const int result = serial_write(buf, nbytes);
   if (result != nbytes) {
     SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Error sending ping, code %d", result);
     return 0;
@@ -289,7 +603,7 @@ int m8_send_msg_controller(const uint8_t input) {
   SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Sending controller input %d", input);
   const unsigned char buf[2] = {'C', input};
   const size_t nbytes = 2;
-  const int result = sp_blocking_write(m8_port, buf, nbytes, 5);
+  const int result = serial_write(buf, nbytes);
   if (result != nbytes) {
     SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Error sending input, code %d", result);
     return -1;
@@ -308,7 +622,7 @@ int m8_send_msg_keyjazz(const uint8_t note, uint8_t velocity) {
     SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Sending keyjazz note off");
     const unsigned char buf[2] = {'K', 0xFF};
     const size_t nbytes = 2;
-    const int result = sp_blocking_write(m8_port, buf, nbytes, 5);
+    const int result = serial_write(buf, nbytes);
     if (result != nbytes) {
       SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Error sending keyjazz, code %d", result);
       return -1;
@@ -320,7 +634,7 @@ int m8_send_msg_keyjazz(const uint8_t note, uint8_t velocity) {
   SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Sending keyjazz note %d, velocity %d", note, velocity);
   const unsigned char buf[3] = {'K', note, velocity};
   const size_t nbytes = 3;
-  const int result = sp_blocking_write(m8_port, buf, nbytes, 5);
+  const int result = serial_write(buf, nbytes);
   if (result != nbytes) {
     SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Error sending keyjazz, code %d", result);
     return -1;
@@ -360,7 +674,7 @@ int m8_reset_display() {
   SDL_Log("Reset display");
 
   const unsigned char buf[1] = {'R'};
-  const int result = sp_blocking_write(m8_port, buf, 1, 5);
+  const int result = serial_write(buf, 1);
   if (result != 1) {
     SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Error resetting M8 display, code %d", result);
     return 0;
@@ -372,7 +686,7 @@ int m8_enable_display(const unsigned char reset_display) {
   SDL_Log("Enabling and resetting M8 display");
 
   const char buf_enable[1] = {'E'};
-  int result = sp_blocking_write(m8_port, buf_enable, 1, 5);
+  int result = serial_write(buf_enable, 1);
   if (result != 1) {
     SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Error enabling M8 display, code %d", result);
     return 0;
@@ -389,44 +703,55 @@ int m8_enable_display(const unsigned char reset_display) {
 }
 
 int m8_process_data(const config_params_s *conf) {
-  static unsigned int empty_cycles = 0;
+  static Uint64 last_message_ticks = 0;
   static message_batch_s batch;
 
   // Device likely has been disconnected
-  if (m8_port == NULL) {
+  if (!port_open()) {
     return DEVICE_DISCONNECTED;
   }
 
+  // The reader thread has stopped on a port error
+  if (SDL_GetAtomicInt(&port_lost)) {
+    last_message_ticks = 0;
+    disconnect();
+    return DEVICE_DISCONNECTED;
+  }
+
+  const Uint64 now = SDL_GetTicks();
+  if (last_message_ticks == 0) {
+    last_message_ticks = now;
+  }
+
   if (pop_all_messages(&queue, &batch) > 0) {
-    empty_cycles = 0;
+    last_message_ticks = now;
+    const Uint64 trace = trace_begin();
     for (unsigned int i = 0; i < batch.count; i++) {
       if (batch.lengths[i] > 0) {
         process_command(batch.messages[i], batch.lengths[i]);
       }
-      SDL_free(batch.messages[i]);
     }
-  } else {
-    empty_cycles++;
-    if (empty_cycles >= conf->wait_packets) {
-      // try opening the serial port to check if it's alive
-      if (serial_port_connected()) {
-        // check if the device responds to display reset
-        if (!send_ping()) {
-          SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Failed to ping device on reconnect");
-          disconnect();
-          return DEVICE_DISCONNECTED;
-        }
-        // the device is still there, carry on
-        empty_cycles = 0;
-        return DEVICE_PROCESSING;
+    trace_end("process_commands", trace);
+  } else if (now - last_message_ticks >= config_device_timeout_ms(conf)) {
+    // try opening the serial port to check if it's alive
+    if (serial_port_connected()) {
+      // check if the device responds to display reset
+      if (!send_ping()) {
+        SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Failed to ping device on reconnect");
+        last_message_ticks = 0;
+        disconnect();
+        return DEVICE_DISCONNECTED;
       }
-      SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
-                   "No messages received for %d cycles, assuming device disconnected",
-                   empty_cycles);
-      empty_cycles = 0;
-      disconnect();
-      return DEVICE_DISCONNECTED;
+      // the device is still there, carry on
+      last_message_ticks = now;
+      return DEVICE_PROCESSING;
     }
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
+                 "No messages received for %llu ms, assuming device disconnected",
+                 (unsigned long long)(now - last_message_ticks));
+    last_message_ticks = 0;
+    disconnect();
+    return DEVICE_DISCONNECTED;
   }
   return DEVICE_PROCESSING;
 }
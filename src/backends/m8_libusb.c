@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../command.h"
+#include "../trace.h"
 #include "queue.h"
 #include "slip.h"
 
@@ -25,16 +26,30 @@ static int ep_in_addr = 0x83;
 #define M8_PID_MULTICHANNEL 0x048b
 
 #define SERIAL_READ_SIZE 1024  // maximum amount of bytes to read from the serial in one pass
+#define MAX_READ_TRANSFERS 16  // upper limit for usb_read_transfers in the config
+#define READ_TRANSFER_TIMEOUT_MS 300
+#define READ_STOP_TIMEOUT_MS 1000 // how long to wait for cancelled reads to come back
+
+// A bulk IN transfer with its own buffer. Several of these are kept queued on the endpoint so the
+// device never has to wait for a callback to resubmit.
+typedef struct {
+  struct libusb_transfer *transfer;
+  uint8_t buffer[SERIAL_READ_SIZE];
+  int submitted; // Queued on the endpoint or waiting to be processed
+  int completed; // Finished, waiting for earlier transfers to be processed first
+} read_transfer_s;
 
 libusb_context *ctx = NULL;
 libusb_device_handle *devh = NULL;
-static uint8_t serial_buffer[SERIAL_READ_SIZE] = {0};
 static uint8_t slip_buffer[SERIAL_READ_SIZE] = {0};
 static slip_handler_s slip;
 message_queue_s queue;
 static int do_exit = 0;
-static int async_transfer_active = 0;
-static struct libusb_transfer *async_transfer = NULL;
+static read_transfer_s read_transfers[MAX_READ_TRANSFERS];
+static int read_transfer_count = 0;  // Size of the pool
+static int next_read_transfer = 0;   // Oldest submission, the next one to be processed
+static int read_transfers_active = 0; // Number of submitted transfers
+static int read_transfers_requested = 4;
 static int shutdown_in_progress = 0;
 
 static int is_m8_device(uint16_t pid) {
@@ -42,10 +57,20 @@ static int is_m8_device(uint16_t pid) {
 }
 
 static int send_message_to_queue(uint8_t *data, const uint32_t size) {
-  push_message(&queue, data, size);
+  if (data == slip_buffer) {
+    // No queue storage was available when the frame started, copy it in
+    push_message(&queue, data, size);
+  } else {
+    commit_message(&queue, size);
+  }
   return 1;
 }
 
+// Let the SLIP decoder write frames straight into the message queue
+static uint8_t *reserve_queue_storage(const uint32_t size) {
+  return reserve_message(&queue, size);
+}
+
 int m8_list_devices() {
   int r;
   r = libusb_init(&ctx);
@@ -79,6 +104,7 @@ static int usb_loop(void *data) {
   (void)data;  // Suppress unused parameter warning
   
   SDL_SetCurrentThreadPriority(SDL_THREAD_PRIORITY_TIME_CRITICAL);
+  trace_name_thread("USB events");
   while (!do_exit) {
     int rc = libusb_handle_events(ctx);
     if (rc != LIBUSB_SUCCESS) {
@@ -155,116 +181,160 @@ static int bulk_async_transfer(int endpoint, uint8_t *serial_buf, int count, uns
   return 0;
 }
 
-static void async_callback(struct libusb_transfer *xfr) {
-  if (shutdown_in_progress) {
-    async_transfer_active = 0;
+// Retire a transfer that won't be resubmitted
+static void retire_read_transfer(read_transfer_s *read_transfer) {
+  read_transfer->submitted = 0;
+  read_transfers_active--;
+}
+
+// Feed a finished transfer to the SLIP decoder and put it back on the endpoint
+static void process_read_transfer(read_transfer_s *read_transfer) {
+  struct libusb_transfer *xfr = read_transfer->transfer;
+
+  if (shutdown_in_progress || xfr->status == LIBUSB_TRANSFER_CANCELLED) {
+    SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Async transfer cancelled");
+    retire_read_transfer(read_transfer);
     return;
   }
 
-  if (xfr->status != LIBUSB_TRANSFER_COMPLETED) {
-    if (xfr->status == LIBUSB_TRANSFER_CANCELLED) {
-      SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Async transfer cancelled");
-      async_transfer_active = 0;
-      return;
-    }
-    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Async transfer failed with status: %s", 
+  // Reads time out when the M8 is idle, possibly with some data already received
+  if (xfr->status != LIBUSB_TRANSFER_COMPLETED && xfr->status != LIBUSB_TRANSFER_TIMED_OUT) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Async transfer failed with status: %s",
                  libusb_error_name(xfr->status));
-    if (!shutdown_in_progress && libusb_submit_transfer(xfr) < 0) {
-      SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Error re-submitting failed transfer");
-      async_transfer_active = 0;
-    }
-    return;
-  }
+  } else if (xfr->actual_length > 0) {
+    SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Received %d bytes from M8", xfr->actual_length);
+    // process the incoming bytes into commands and draw them
+    const Uint64 trace = trace_begin();
+    int n = slip_read_buffer(&slip, xfr->buffer, (uint32_t)xfr->actual_length);
+    trace_end("slip_decode", trace);
+    if (n != SLIP_NO_ERROR) {
+      if (n == SLIP_ERROR_INVALID_PACKET) {
+        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Invalid SLIP packet!\n");
 
-  int bytes_read = xfr->actual_length;
-  if (bytes_read < 0) {
-    SDL_LogCritical(SDL_LOG_CATEGORY_ERROR, "Error %d reading serial", (int)bytes_read);
-  } else if (bytes_read > 0) {
-    SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Received %d bytes from M8", bytes_read);
-    uint8_t *serial_buf = xfr->buffer;
-    uint8_t *cur = serial_buf;
-    const uint8_t *end = serial_buf + bytes_read;
-    slip_handler_s *slip = (slip_handler_s *)xfr->user_data;
-    while (cur < end) {
-      // process the incoming bytes into commands and draw them
-      int n = slip_read_byte(slip, *(cur++));
-      if (n != SLIP_NO_ERROR) {
-        if (n == SLIP_ERROR_INVALID_PACKET) {
-          SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Invalid SLIP packet!\n");
-
-        } else {
-          SDL_LogError(SDL_LOG_CATEGORY_ERROR, "SLIP error %d\n", n);
-        }
+      } else {
+        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "SLIP error %d\n", n);
       }
     }
   }
-  if (!shutdown_in_progress) {
-    int submit_result = libusb_submit_transfer(xfr);
-    if (submit_result < 0) {
-      SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Error re-submitting URB: %s", 
-                   libusb_error_name(submit_result));
-      async_transfer_active = 0;
+
+  int submit_result = libusb_submit_transfer(xfr);
+  if (submit_result < 0) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Error re-submitting URB: %s",
+                 libusb_error_name(submit_result));
+    retire_read_transfer(read_transfer);
+  }
+}
+
+static void LIBUSB_CALL async_callback(struct libusb_transfer *xfr) {
+  read_transfer_s *read_transfer = xfr->user_data;
+  read_transfer->completed = 1;
+
+  // Bulk transfers on one endpoint normally complete in order, but make sure of it: the SLIP
+  // decoder state depends on seeing the bytes in the order they were sent. Resubmitted transfers
+  // go to the back of the line, retired ones are skipped.
+  for (int i = 0; i < read_transfer_count; i++) {
+    read_transfer = &read_transfers[next_read_transfer];
+    if (read_transfer->submitted && !read_transfer->completed) {
+      break; // Still in flight, everything after it has to wait
+    }
+    next_read_transfer = (next_read_transfer + 1) % read_transfer_count;
+    if (read_transfer->completed) {
+      read_transfer->completed = 0;
+      process_read_transfer(read_transfer);
     }
-  } else {
-    async_transfer_active = 0;
   }
 }
 
-int async_read_start(uint8_t *serial_buf, int count, slip_handler_s *slip) {
-  if (async_transfer_active) {
+static void free_read_transfers(void) {
+  for (int i = 0; i < read_transfer_count; i++) {
+    libusb_free_transfer(read_transfers[i].transfer);
+    read_transfers[i].transfer = NULL;
+  }
+  read_transfer_count = 0;
+}
+
+static int async_read_start(int transfer_count) {
+  if (read_transfers_active > 0) {
     SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Async transfer already active, skipping");
     return 0; // Already active
   }
-  
+
   if (devh == NULL) {
     SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Device handle is NULL, cannot start async transfer");
     return -1;
   }
-  
-  async_transfer = libusb_alloc_transfer(1);
-  if (!async_transfer) {
-    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Failed to allocate async transfer");
-    return -1;
+
+  transfer_count = SDL_clamp(transfer_count, 1, MAX_READ_TRANSFERS);
+  next_read_transfer = 0;
+  for (read_transfer_count = 0; read_transfer_count < transfer_count; read_transfer_count++) {
+    read_transfer_s *read_transfer = &read_transfers[read_transfer_count];
+    read_transfer->submitted = 0;
+    read_transfer->completed = 0;
+    read_transfer->transfer = libusb_alloc_transfer(0);
+    if (!read_transfer->transfer) {
+      SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Failed to allocate async transfer");
+      free_read_transfers();
+      return -1;
+    }
+    libusb_fill_bulk_transfer(read_transfer->transfer, devh, ep_in_addr, read_transfer->buffer,
+                              SERIAL_READ_SIZE, &async_callback, read_transfer,
+                              READ_TRANSFER_TIMEOUT_MS);
+  }
+
+  // Called before the USB thread starts handling events, so no callback can run in between
+  read_transfers_active = 0;
+  for (int i = 0; i < read_transfer_count; i++) {
+    int r = libusb_submit_transfer(read_transfers[i].transfer);
+    if (r < 0) {
+      SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Error starting async transfer: %s",
+                   libusb_error_name(r));
+      read_transfers[i].submitted = 0;
+    } else {
+      read_transfers[i].submitted = 1;
+      read_transfers_active++;
+    }
   }
-  
-  libusb_fill_bulk_stream_transfer(async_transfer, devh, ep_in_addr, 0, serial_buf, count, 
-                                   &async_callback, slip, 300);
-  int r = libusb_submit_transfer(async_transfer);
-  
-  if (r < 0) {
-    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Error starting async transfer: %s", libusb_error_name(r));
-    libusb_free_transfer(async_transfer);
-    async_transfer = NULL;
-    return r;
+
+  if (read_transfers_active == 0) {
+    free_read_transfers();
+    return -1;
   }
-  
-  async_transfer_active = 1;
-  SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Async transfer started successfully");
+
+  SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Started %d async transfers", read_transfers_active);
   return 0;
 }
 
-void async_read_stop() {
+static void async_read_stop() {
   shutdown_in_progress = 1;
-  
-  if (async_transfer_active && async_transfer) {
-    SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Stopping async transfer");
-    int cancel_result = libusb_cancel_transfer(async_transfer);
-    if (cancel_result < 0) {
-      if (cancel_result == LIBUSB_ERROR_NOT_FOUND) {
-        SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Transfer already completed or cancelled");
-      } else if (cancel_result == LIBUSB_ERROR_INVALID_PARAM) {
-        SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Transfer not valid for cancellation");
-      } else {
-        SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Transfer cancellation returned: %s", 
-                     libusb_error_name(cancel_result));
-      }
+
+  if (read_transfers_active == 0) {
+    return;
+  }
+
+  SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Stopping %d async transfers", read_transfers_active);
+  for (int i = 0; i < read_transfer_count; i++) {
+    if (!read_transfers[i].submitted) {
+      continue;
     }
-    // Wait briefly for the callback to complete
-    for (int i = 0; i < 10 && async_transfer_active; i++) {
-      SDL_Delay(1);
+    int cancel_result = libusb_cancel_transfer(read_transfers[i].transfer);
+    if (cancel_result < 0 && cancel_result != LIBUSB_ERROR_NOT_FOUND) {
+      SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Transfer cancellation returned: %s",
+                   libusb_error_name(cancel_result));
     }
-    // Force cleanup if still active
-    async_transfer_active = 0;
+  }
+
+  // The USB thread delivers the cancellations; sleep until it has handled all of them
+  const Uint64 deadline = SDL_GetTicks() + READ_STOP_TIMEOUT_MS;
+  libusb_lock_event_waiters(ctx);
+  while (read_transfers_active > 0 && SDL_GetTicks() < deadline) {
+    struct timeval timeout = {0, 10000};
+    libusb_wait_for_event(ctx, &timeout);
+  }
+  libusb_unlock_event_waiters(ctx);
+
+  if (read_transfers_active > 0) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "%d async transfers did not stop in time",
+                 read_transfers_active);
   }
 }
 
@@ -274,12 +344,13 @@ int m8_process_data(const config_params_s *conf) {
 
   // Process any queued messages
   if (pop_all_messages(&queue, &batch) > 0) {
+    const Uint64 trace = trace_begin();
     for (unsigned int i = 0; i < batch.count; i++) {
       if (batch.lengths[i] > 0) {
         process_command(batch.messages[i], batch.lengths[i]);
       }
-      SDL_free(batch.messages[i]);
     }
+    trace_end("process_commands", trace);
   }
   return DEVICE_PROCESSING;
 }
@@ -335,13 +406,13 @@ int init_interface() {
 
   init_queue(&queue);
 
-  usb_thread = SDL_CreateThread(&usb_loop, "USB", NULL);
-
-  // Start async transfer for reading data from M8
-  if (async_read_start(serial_buffer, SERIAL_READ_SIZE, &slip) < 0) {
+  // Start async transfers for reading data from M8
+  if (async_read_start(read_transfers_requested) < 0) {
     SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Failed to start async transfer during initialization");
   }
 
+  usb_thread = SDL_CreateThread(&usb_loop, "USB", NULL);
+
   return 1;
 }
 
@@ -377,7 +448,7 @@ int init_serial_with_file_descriptor(int file_descriptor) {
   return init_interface();
 }
 
-int m8_initialize(int verbose, const char *preferred_device) {
+int m8_initialize(int verbose, const char *preferred_device, const config_params_s *conf) {
   (void)verbose; // Suppress unused parameter warning
   (void)preferred_device; // Suppress unused parameter warning
 
@@ -385,11 +456,14 @@ int m8_initialize(int verbose, const char *preferred_device) {
     return 1;
   }
 
+  read_transfers_requested = (int)conf->usb_read_transfers;
+
   // Initialize slip descriptor
   static const slip_descriptor_s slip_descriptor = {
       .buf = slip_buffer,
       .buf_size = sizeof(slip_buffer),
       .recv_message = send_message_to_queue,
+      .get_buffer = reserve_queue_storage,
   };
   slip_init(&slip, &slip_descriptor);
 
@@ -538,12 +612,9 @@ int m8_close() {
   libusb_exit(ctx);
 
   destroy_queue(&queue);
-  
-  if (async_transfer) {
-    libusb_free_transfer(async_transfer);
-    async_transfer = NULL;
-  }
-  async_transfer_active = 0;
+
+  free_read_transfers();
+  read_transfers_active = 0;
   shutdown_in_progress = 0;
 
   return 1;
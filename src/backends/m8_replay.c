@@ -0,0 +1,184 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+#ifdef USE_REPLAY
+
+#include "../command.h"
+#include "../config.h"
+#include "../draw_batch.h"
+#include "../stats.h"
+#include "capture.h"
+#include "m8.h"
+#include "replay.h"
+#include <SDL3/SDL.h>
+
+// Capture time delivered per step in the single-step mode
+#define STEP_US 16667
+// Time spent processing frames per main loop iteration in the fast mode. Longer than an iteration
+// of the main loop at any frame pacing mode, so the loop never idles and the playback speed
+// doesn't depend on the loop rate.
+#define FAST_BUDGET_NS (4 * SDL_NS_PER_MS)
+#define MAX_FRAME_SIZE 4096
+
+static const char *mode_names[] = {"realtime", "fast", "step"};
+
+static enum replay_mode mode = REPLAY_REALTIME;
+static capture_reader_s reader;
+
+// The frame to be processed next, read ahead to know its timestamp
+static uint8_t next_frame[MAX_FRAME_SIZE];
+static uint32_t next_frame_size;
+static int next_frame_valid = 0;
+
+static Uint64 start_ns;    // Wall clock time at capture time 0 in real-time mode
+static Uint64 position_us; // Capture time processed so far
+static Uint64 paused_ns = 0;
+static int steps_requested = 0;
+static Uint64 frames_processed = 0;
+
+int replay_set_mode(const char *name) {
+  for (int i = 0; i < (int)SDL_arraysize(mode_names); i++) {
+    if (SDL_strcasecmp(name, mode_names[i]) == 0) {
+      mode = (enum replay_mode)i;
+      return 1;
+    }
+  }
+  SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Unknown replay mode %s", name);
+  return 0;
+}
+
+static void read_next_frame(void) {
+  next_frame_valid =
+      capture_reader_next(&reader, next_frame, sizeof(next_frame), &next_frame_size) == 1;
+}
+
+static void process_next_frame(void) {
+  if (next_frame_size > 0) {
+    stats_bytes_received(next_frame_size);
+    process_command(next_frame, next_frame_size);
+  }
+  frames_processed++;
+  read_next_frame();
+}
+
+int m8_initialize(const int verbose, const char *preferred_device, const config_params_s *conf) {
+  (void)conf;
+
+  if (preferred_device == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "No capture file given, use --replay <file>");
+    return 0;
+  }
+
+  capture_reader_close(&reader);
+  if (!capture_reader_open(&reader, preferred_device)) {
+    return 0;
+  }
+  read_next_frame();
+
+  start_ns = SDL_GetTicksNS();
+  position_us = 0;
+  paused_ns = 0;
+  steps_requested = 0;
+  frames_processed = 0;
+
+  if (verbose) {
+    SDL_Log("Replaying %s in %s mode", preferred_device, mode_names[mode]);
+  }
+  return 1;
+}
+
+int m8_list_devices(void) {
+  SDL_Log("The replay backend has no devices, use --replay <file>");
+  return 0;
+}
+
+int m8_reset_display(void) { return 1; }
+
+int m8_enable_display(const unsigned char reset_display) {
+  (void)reset_display;
+  return 1;
+}
+
+int m8_send_msg_controller(const unsigned char input) {
+  if (mode == REPLAY_STEP && input != 0) {
+    steps_requested++;
+  }
+  return 1;
+}
+
+int m8_send_msg_keyjazz(const unsigned char note, unsigned char velocity) {
+  (void)note;
+  (void)velocity;
+  return 1;
+}
+
+int m8_process_data(const config_params_s *conf) {
+  (void)conf;
+
+  if (reader.io == NULL) {
+    return DEVICE_DISCONNECTED;
+  }
+  if (paused_ns != 0) {
+    return DEVICE_PROCESSING;
+  }
+
+  if (mode == REPLAY_FAST) {
+    // As many frames as fit in the time budget, or until the draw batch has to be rendered
+    const Uint64 deadline_ns = SDL_GetTicksNS() + FAST_BUDGET_NS;
+    while (next_frame_valid) {
+      process_next_frame();
+      if (draw_batch_is_full() || SDL_GetTicksNS() >= deadline_ns) {
+        break;
+      }
+    }
+  } else {
+    Uint64 target_us;
+    if (mode == REPLAY_REALTIME) {
+      target_us = (SDL_GetTicksNS() - start_ns) / SDL_NS_PER_US;
+    } else {
+      if (steps_requested == 0) {
+        return DEVICE_PROCESSING;
+      }
+      steps_requested--;
+      // Skip over periods where nothing was received
+      const Uint64 from =
+          next_frame_valid ? SDL_max(position_us, reader.timestamp_us) : position_us;
+      target_us = from + STEP_US;
+    }
+
+    while (next_frame_valid && reader.timestamp_us <= target_us) {
+      process_next_frame();
+    }
+    position_us = target_us;
+  }
+
+  if (!next_frame_valid) {
+    SDL_Log("Replay finished, %llu frames in %.1f s of capture time, played in %.1f s",
+            (unsigned long long)frames_processed, (double)reader.timestamp_us / 1000000.0,
+            (double)(SDL_GetTicksNS() - start_ns) / SDL_NS_PER_SECOND);
+    capture_reader_close(&reader);
+    return DEVICE_DISCONNECTED;
+  }
+  return DEVICE_PROCESSING;
+}
+
+int m8_close(void) {
+  capture_reader_close(&reader);
+  return 1;
+}
+
+int m8_pause_processing(void) {
+  if (paused_ns == 0) {
+    paused_ns = SDL_GetTicksNS();
+  }
+  return 1;
+}
+
+int m8_resume_processing(void) {
+  if (paused_ns != 0) {
+    // Real-time playback continues where it left off
+    start_ns += SDL_GetTicksNS() - paused_ns;
+    paused_ns = 0;
+  }
+  return 1;
+}
+#endif
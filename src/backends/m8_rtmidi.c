@@ -8,6 +8,9 @@
 
 #include "../command.h"
 #include "../config.h"
+#include "../stats.h"
+#include "../trace.h"
+#include "capture.h"
 #include "m8.h"
 #include "queue.h"
 #include <SDL3/SDL.h>
@@ -95,6 +98,8 @@ static void midi_callback(double delta_time, const unsigned char *message, size_
   if (midi_processing_suspended || message_size < 5 || !message_is_m8_sysex(message))
     return;
 
+  stats_bytes_received((Uint32)message_size);
+
   if (!midi_sysex_received) {
     midi_sysex_received = true;
   }
@@ -115,6 +120,7 @@ static void midi_callback(double delta_time, const unsigned char *message, size_
       printf("%02X ", midi_decode_buffer[i]);
     }
     printf("\n"); */
+    capture_frame(midi_decode_buffer, decoded_length);
     push_message(&queue, midi_decode_buffer, decoded_length);
   } else {
     SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Decoding failed.\n");
@@ -205,7 +211,8 @@ static int disconnect(void) {
   return !result;
 }
 
-int m8_initialize(const int verbose, const char *preferred_device) {
+int m8_initialize(const int verbose, const char *preferred_device, const config_params_s *conf) {
+  (void)conf;
   int m8_midi_port_number = 0;
 
   SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Initialize M8 via RTMIDI called");
@@ -324,28 +331,32 @@ int m8_send_msg_keyjazz(const unsigned char note, unsigned char velocity) {
 }
 
 int m8_process_data(const config_params_s *conf) {
-  static unsigned int empty_cycles = 0;
+  static Uint64 last_message_ticks = 0;
   static message_batch_s batch;
 
+  const Uint64 now = SDL_GetTicks();
+  if (last_message_ticks == 0) {
+    last_message_ticks = now;
+  }
+
   if (pop_all_messages(&queue, &batch) > 0) {
-    empty_cycles = 0;
+    last_message_ticks = now;
+    const Uint64 trace = trace_begin();
     for (unsigned int i = 0; i < batch.count; i++) {
       process_command(batch.messages[i], batch.lengths[i]);
-      SDL_free(batch.messages[i]);
     }
-  } else {
-    empty_cycles++;
-    if (empty_cycles >= conf->wait_packets) {
-      if (device_still_exists()) {
-        empty_cycles = 0;
-        return DEVICE_PROCESSING;
-      }
-      SDL_Log("No messages received for %d cycles, assuming device disconnected", empty_cycles);
-      close_and_free_midi_ports();
-      destroy_queue(&queue);
-      empty_cycles = 0;
-      return DEVICE_DISCONNECTED;
+    trace_end("process_commands", trace);
+  } else if (now - last_message_ticks >= config_device_timeout_ms(conf)) {
+    if (device_still_exists()) {
+      last_message_ticks = now;
+      return DEVICE_PROCESSING;
     }
+    SDL_Log("No messages received for %llu ms, assuming device disconnected",
+            (unsigned long long)(now - last_message_ticks));
+    close_and_free_midi_ports();
+    destroy_queue(&queue);
+    last_message_ticks = 0;
+    return DEVICE_DISCONNECTED;
   }
   return DEVICE_PROCESSING;
 }
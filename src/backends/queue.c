@@ -1,85 +1,246 @@
 #include "queue.h"
+#include "../stats.h"
 #include <SDL3/SDL.h>
 #include <stdlib.h>
 #include <string.h>
 
+#define QUEUE_ARENA_MASK (QUEUE_ARENA_SIZE - 1)
+#define QUEUE_STATS_INTERVAL_MS 5000
+
+SDL_COMPILE_TIME_ASSERT(queue_arena_size_pow2, (QUEUE_ARENA_SIZE & QUEUE_ARENA_MASK) == 0);
+
+// SDL's atomic get/set are full barriers, which covers the acquire/release pairing below:
+// the producer fills a slot before publishing rear, the consumer releases slots before
+// publishing front.
+static int load_acquire(SDL_AtomicInt *index) { return SDL_GetAtomicInt(index); }
+
+static void store_release(SDL_AtomicInt *index, int value) { SDL_SetAtomicInt(index, value); }
+
+static int is_arena_message(const message_queue_s *queue, const unsigned char *message) {
+  return message >= queue->arena && message < queue->arena + QUEUE_ARENA_SIZE;
+}
+
+// Find contiguous space in the arena without claiming it. Returns 0 if there is not enough room.
+// Producer thread only.
+static int arena_find(message_queue_s *queue, size_t length, Uint32 *position) {
+  if (queue->arena == NULL || length > QUEUE_ARENA_SIZE) {
+    return 0;
+  }
+
+  *position = queue->arena_tail;
+
+  // Empty frames (e.g. back-to-back SLIP END bytes) don't need any storage
+  if (length == 0) {
+    return 1;
+  }
+
+  const Uint32 offset = *position & QUEUE_ARENA_MASK;
+
+  // Messages are never split; skip the remainder of the arena if the message doesn't fit
+  if (offset + length > QUEUE_ARENA_SIZE) {
+    *position += QUEUE_ARENA_SIZE - offset;
+  }
+
+  const Uint32 head = SDL_GetAtomicU32(&queue->arena_head);
+  return (Uint32)(*position + length - head) <= QUEUE_ARENA_SIZE;
+}
+
+// Reserve contiguous space from the arena. Returns NULL if there is not enough room.
+// Producer thread only.
+static unsigned char *arena_reserve(message_queue_s *queue, size_t length) {
+  Uint32 position;
+  if (!arena_find(queue, length, &position)) {
+    return NULL;
+  }
+
+  queue->arena_tail = position + (Uint32)length;
+  return queue->arena + (position & QUEUE_ARENA_MASK);
+}
+
+// Fill in the slot at rear and make it visible to the consumer. Producer thread only.
+static void publish_message(message_queue_s *queue, int rear, unsigned char *storage,
+                            size_t length) {
+  queue->messages[rear] = storage;
+  queue->lengths[rear] = length;
+  queue->arena_ends[rear] = queue->arena_tail;
+  SDL_AddAtomicInt(&queue->stats_messages, 1);
+
+  // The consumer resets the high-water mark, so raise it with a compare-and-swap
+  const int depth = (rear + 1 - SDL_GetAtomicInt(&queue->front) + MAX_QUEUE_SIZE) % MAX_QUEUE_SIZE;
+  int high_water = SDL_GetAtomicInt(&queue->stats_high_water);
+  while (depth > high_water &&
+         !SDL_CompareAndSwapAtomicInt(&queue->stats_high_water, high_water, depth)) {
+    high_water = SDL_GetAtomicInt(&queue->stats_high_water);
+  }
+
+  store_release(&queue->rear, (rear + 1) % MAX_QUEUE_SIZE);
+}
+
+// Give back everything the consumer has been handed out since the previous pop.
+// Consumer thread only.
+static void release_popped_messages(message_queue_s *queue) {
+  int front = SDL_GetAtomicInt(&queue->front);
+  if (front == queue->read) {
+    return;
+  }
+
+  while (front != queue->read) {
+    if (!is_arena_message(queue, queue->messages[front])) {
+      SDL_free(queue->messages[front]);
+    }
+    front = (front + 1) % MAX_QUEUE_SIZE;
+  }
+
+  const int last = (queue->read + MAX_QUEUE_SIZE - 1) % MAX_QUEUE_SIZE;
+  SDL_SetAtomicU32(&queue->arena_head, queue->arena_ends[last]);
+  store_release(&queue->front, front);
+}
+
+static void log_queue_stats(message_queue_s *queue) {
+  const Uint64 now = SDL_GetTicks();
+  if (now - queue->stats_ticks > QUEUE_STATS_INTERVAL_MS) {
+    const float seconds = (float)(now - queue->stats_ticks) / 1000.0f;
+    const int messages = SDL_SetAtomicInt(&queue->stats_messages, 0);
+    const int heap_allocations = SDL_SetAtomicInt(&queue->stats_heap_allocations, 0);
+    const int dropped = SDL_SetAtomicInt(&queue->stats_dropped, 0);
+    SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM,
+                 "Queue: %.1f messages/s, %.1f heap allocations/s, %d dropped",
+                 (float)messages / seconds, (float)heap_allocations / seconds, dropped);
+    queue->stats_ticks = now;
+  }
+}
+
 // Initialize the message queue
 void init_queue(message_queue_s *queue) {
-    queue->front = 0;
-    queue->rear = 0;
-    queue->mutex = SDL_CreateMutex();
-    queue->cond = SDL_CreateCondition();
+  SDL_SetAtomicInt(&queue->front, 0);
+  SDL_SetAtomicInt(&queue->rear, 0);
+  queue->read = 0;
+  queue->arena = SDL_malloc(QUEUE_ARENA_SIZE);
+  if (queue->arena == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Cannot allocate message arena, using heap");
+  }
+  SDL_SetAtomicU32(&queue->arena_head, 0);
+  queue->arena_tail = 0;
+  queue->reserved = NULL;
+  SDL_SetAtomicInt(&queue->stats_messages, 0);
+  SDL_SetAtomicInt(&queue->stats_heap_allocations, 0);
+  SDL_SetAtomicInt(&queue->stats_dropped, 0);
+  SDL_SetAtomicInt(&queue->stats_high_water, 0);
+  queue->stats_ticks = SDL_GetTicks();
 }
 
-// Free allocated memory and destroy mutex
+// Free allocated memory. Both producer and consumer must have stopped.
 void destroy_queue(message_queue_s *queue) {
-  SDL_LockMutex(queue->mutex);
+  int front = SDL_GetAtomicInt(&queue->front);
+  const int rear = SDL_GetAtomicInt(&queue->rear);
 
-  while (queue->front != queue->rear) {
-    SDL_free(queue->messages[queue->front]);
-    queue->front = (queue->front + 1) % MAX_QUEUE_SIZE;
+  while (front != rear) {
+    if (!is_arena_message(queue, queue->messages[front])) {
+      SDL_free(queue->messages[front]);
+    }
+    front = (front + 1) % MAX_QUEUE_SIZE;
   }
+  SDL_SetAtomicInt(&queue->front, front);
+  queue->read = front;
 
-  SDL_UnlockMutex(queue->mutex);
-  SDL_DestroyMutex(queue->mutex);
-  SDL_DestroyCondition(queue->cond);
+  SDL_free(queue->arena);
+  queue->arena = NULL;
 }
 
 // Push a message to the queue
 void push_message(message_queue_s *queue, const unsigned char *message, size_t length) {
-    SDL_LockMutex(queue->mutex);
-
-    if ((queue->rear + 1) % MAX_QUEUE_SIZE == queue->front) {
-        SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,"Queue is full, cannot add message.");
-    } else {
-        // Allocate space for the message and store it
-        queue->messages[queue->rear] = SDL_malloc(length);
-        SDL_memcpy(queue->messages[queue->rear], message, length);
-        queue->lengths[queue->rear] = length;
-        queue->rear = (queue->rear + 1) % MAX_QUEUE_SIZE;
-        SDL_SignalCondition(queue->cond);  // Signal consumer thread
-    }
+  const int rear = SDL_GetAtomicInt(&queue->rear);
+  const int next = (rear + 1) % MAX_QUEUE_SIZE;
+
+  if (next == load_acquire(&queue->front)) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Queue is full, cannot add message.");
+    SDL_AddAtomicInt(&queue->stats_dropped, 1);
+    return;
+  }
+
+  // Store the message in the arena, fall back to the heap if it's exhausted
+  unsigned char *storage = arena_reserve(queue, length);
+  if (storage == NULL) {
+    storage = SDL_malloc(length > 0 ? length : 1);
+    SDL_AddAtomicInt(&queue->stats_heap_allocations, 1);
+  }
+  if (storage == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Cannot allocate memory for message.");
+    SDL_AddAtomicInt(&queue->stats_dropped, 1);
+    return;
+  }
+
+  SDL_memcpy(storage, message, length);
+  publish_message(queue, rear, storage, length);
+}
+
+unsigned char *reserve_message(message_queue_s *queue, size_t max_length) {
+  const int rear = SDL_GetAtomicInt(&queue->rear);
+
+  queue->reserved = NULL;
+  if ((rear + 1) % MAX_QUEUE_SIZE == load_acquire(&queue->front)) {
+    return NULL;
+  }
+  if (!arena_find(queue, max_length, &queue->reserved_position)) {
+    return NULL;
+  }
 
-    SDL_UnlockMutex(queue->mutex);
+  queue->reserved = queue->arena + (queue->reserved_position & QUEUE_ARENA_MASK);
+  return queue->reserved;
+}
+
+void commit_message(message_queue_s *queue, size_t length) {
+  if (queue->reserved == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Cannot commit message without a reservation.");
+    return;
+  }
+
+  // The reservation already checked for a free slot and arena space for at least this much
+  queue->arena_tail = queue->reserved_position + (Uint32)length;
+  publish_message(queue, SDL_GetAtomicInt(&queue->rear), queue->reserved, length);
+  queue->reserved = NULL;
 }
 
 // Pop a message from the queue
 unsigned char *pop_message(message_queue_s *queue, size_t *length) {
-  SDL_LockMutex(queue->mutex);
+  release_popped_messages(queue);
 
   // Check if the queue is empty
-  if (queue->front == queue->rear) {
-    SDL_UnlockMutex(queue->mutex);
-    return NULL;  // Return NULL if there are no messages
+  if (queue->read == load_acquire(&queue->rear)) {
+    return NULL; // Return NULL if there are no messages
   }
 
   // Otherwise, retrieve the message and its length
-  *length = queue->lengths[queue->front];
-  unsigned char *message = queue->messages[queue->front];
-  queue->front = (queue->front + 1) % MAX_QUEUE_SIZE;
+  *length = queue->lengths[queue->read];
+  unsigned char *message = queue->messages[queue->read];
+  queue->read = (queue->read + 1) % MAX_QUEUE_SIZE;
 
-  SDL_UnlockMutex(queue->mutex);
   return message;
 }
 
 unsigned int queue_size(const message_queue_s *queue) {
-  SDL_LockMutex(queue->mutex);
-  const unsigned int size = (queue->rear - queue->front + MAX_QUEUE_SIZE) % MAX_QUEUE_SIZE;
-  SDL_UnlockMutex(queue->mutex);
-  return size;
+  message_queue_s *q = (message_queue_s *)queue; // SDL atomics take non-const pointers
+  const int front = load_acquire(&q->front);
+  const int rear = load_acquire(&q->rear);
+  return (unsigned int)((rear - front + MAX_QUEUE_SIZE) % MAX_QUEUE_SIZE);
 }
 
 unsigned int pop_all_messages(message_queue_s *queue, message_batch_s *batch) {
-  SDL_LockMutex(queue->mutex);
+  release_popped_messages(queue);
+
+  // Take a snapshot of rear; anything pushed after this is picked up on the next call
+  const int rear = load_acquire(&queue->rear);
 
   batch->count = 0;
-  while (queue->front != queue->rear) {
-    batch->lengths[batch->count] = queue->lengths[queue->front];
-    batch->messages[batch->count] = queue->messages[queue->front];
-    queue->front = (queue->front + 1) % MAX_QUEUE_SIZE;
+  while (queue->read != rear) {
+    batch->lengths[batch->count] = queue->lengths[queue->read];
+    batch->messages[batch->count] = queue->messages[queue->read];
+    queue->read = (queue->read + 1) % MAX_QUEUE_SIZE;
     batch->count++;
   }
 
-  SDL_UnlockMutex(queue->mutex);
+  log_queue_stats(queue);
+  stats_batch(batch->count, (unsigned int)SDL_SetAtomicInt(&queue->stats_high_water, 0));
+
   return batch->count;
-}
\ No newline at end of file
+}
@@ -8,14 +8,31 @@
 #include <SDL3/SDL.h>
 
 #define MAX_QUEUE_SIZE 8192
+#define QUEUE_ARENA_SIZE (256 * 1024) // must be a power of two
 
+// Single-producer/single-consumer queue: one reader thread pushes, the main thread pops.
+// Indices owned by each side live on their own cache line to avoid false sharing.
 typedef struct {
   unsigned char *messages[MAX_QUEUE_SIZE];
   size_t lengths[MAX_QUEUE_SIZE]; // Store lengths of each message
-  int front;
-  int rear;
-  SDL_Mutex *mutex;
-  SDL_Condition *cond;
+  Uint32 arena_ends[MAX_QUEUE_SIZE]; // Arena write position after each message
+  unsigned char *arena; // Preallocated storage for message payloads
+
+  // Producer side
+  SDL_ALIGNED(SDL_CACHELINE_SIZE) SDL_AtomicInt rear;
+  Uint32 arena_tail; // Next arena write position (monotonic, wraps)
+  unsigned char *reserved; // Storage handed out by reserve_message(), if any
+  Uint32 reserved_position;
+  SDL_AtomicInt stats_messages;
+  SDL_AtomicInt stats_heap_allocations;
+  SDL_AtomicInt stats_dropped;
+  SDL_AtomicInt stats_high_water; // Deepest the queue has been since the last pop_all_messages()
+
+  // Consumer side
+  SDL_ALIGNED(SDL_CACHELINE_SIZE) SDL_AtomicInt front; // First slot still owned by the consumer
+  SDL_AtomicU32 arena_head; // Oldest arena byte still in use (monotonic, wraps)
+  int read;                 // First slot not yet handed out to the consumer
+  Uint64 stats_ticks;
 } message_queue_s;
 
 typedef struct {
@@ -39,8 +56,11 @@ void init_queue(message_queue_s *queue);
 void destroy_queue(message_queue_s *queue);
 
 /**
- * Retrieves and removes a message from the front of the message queue.
+ * Retrieves and removes a message from the front of the message queue. Must only be called from
+ * the consumer thread.
  * If the queue is empty, the function returns NULL.
+ * The message is owned by the queue and stays valid until the next call to pop_message() or
+ * pop_all_messages(). It must not be freed by the caller.
  *
  * @param queue A pointer to the message queue structure from which the message is to be retrieved.
  * @param length A pointer to a variable where the length of the retrieved message will be stored.
@@ -50,7 +70,9 @@ unsigned char *pop_message(message_queue_s *queue, size_t *length);
 
 /**
  * Adds a new message to the message queue.
- * If the queue is full, the message will not be added.
+ * The message is copied into the queue's preallocated arena. If the arena is exhausted, the
+ * message falls back to a heap allocation. If the queue is full, the message will not be added.
+ * Never blocks. Must only be called from the producer thread.
  *
  * @param queue A pointer to the message queue structure where the message is to be stored.
  * @param message A pointer to the message data to be added to the queue.
@@ -59,7 +81,29 @@ unsigned char *pop_message(message_queue_s *queue, size_t *length);
 void push_message(message_queue_s *queue, const unsigned char *message, size_t length);
 
 /**
- * Calculates the current size of the message queue.
+ * Reserves storage for the next message so that it can be written in place, without the copy
+ * made by push_message(). The space is not visible to the consumer until commit_message() is
+ * called. To abort, simply don't commit: the next reservation hands out the same space.
+ * Must only be called from the producer thread.
+ *
+ * @param queue A pointer to the message queue structure.
+ * @param max_length The maximum number of bytes the message may occupy.
+ * @return A pointer to at least max_length bytes, or NULL if the queue or its arena is full.
+ */
+unsigned char *reserve_message(message_queue_s *queue, size_t max_length);
+
+/**
+ * Publishes the message written into the storage returned by reserve_message().
+ * Must only be called from the producer thread.
+ *
+ * @param queue A pointer to the message queue structure.
+ * @param length The actual length of the message, not greater than the reserved max_length.
+ */
+void commit_message(message_queue_s *queue, size_t length);
+
+/**
+ * Calculates the current size of the message queue. This includes the most recently popped
+ * messages, which keep their slots until the next pop. Safe to call from either thread.
  *
  * @param queue A pointer to the message queue structure whose size is to be determined.
  * @return The number of messages currently in the queue.
@@ -67,7 +111,10 @@ void push_message(message_queue_s *queue, const unsigned char *message, size_t l
 unsigned int queue_size(const message_queue_s *queue);
 
 /**
- * Pops all messages from the queue in a single lock acquisition.
+ * Pops all messages currently in the queue without blocking the producer. Must only be called
+ * from the consumer thread.
+ * The messages are owned by the queue and stay valid until the next call to pop_message() or
+ * pop_all_messages(). They must not be freed by the caller.
  *
  * @param queue A pointer to the message queue structure.
  * @param batch A pointer to a batch structure that will receive the messages.
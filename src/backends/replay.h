@@ -0,0 +1,18 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#ifndef REPLAY_H_
+#define REPLAY_H_
+
+// Playback modes of the replay backend, which implements m8.h by feeding frames from a capture
+// file (see capture.h) instead of a device. The capture file is given as the preferred device.
+enum replay_mode {
+  REPLAY_REALTIME, // Frames are processed at their recorded times
+  REPLAY_FAST,     // As many frames as fit in a few milliseconds per main loop iteration
+  REPLAY_STEP,     // One 60 Hz frame worth of data when an M8 key is pressed, idle time skipped
+};
+
+// Select a playback mode by name: realtime, fast or step. Returns 0 for an unknown name.
+int replay_set_mode(const char *name);
+
+#endif
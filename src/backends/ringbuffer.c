@@ -1,55 +1,102 @@
 #include "ringbuffer.h"
 #include <SDL3/SDL.h>
 
+// SDL's atomic get/set are full barriers: the producer fills the buffer before publishing tail,
+// and the consumer is done with the data before publishing head.
+
 RingBuffer *ring_buffer_create(uint32_t size) {
-  RingBuffer *rb = SDL_malloc(sizeof(*rb));
-  rb->buffer = SDL_malloc(sizeof(*rb->buffer) * size);
-  rb->head = 0;
-  rb->tail = 0;
-  rb->max_size = size;
-  rb->size = 0;
+  uint32_t capacity = 1;
+  while (capacity < size) {
+    capacity <<= 1;
+  }
+
+  RingBuffer *rb = SDL_calloc(1, sizeof(*rb));
+  if (rb == NULL) {
+    return NULL;
+  }
+  rb->buffer = SDL_malloc(capacity);
+  if (rb->buffer == NULL) {
+    SDL_free(rb);
+    return NULL;
+  }
+  rb->max_size = capacity;
+  rb->mask = capacity - 1;
+  SDL_SetAtomicU32(&rb->head, 0);
+  SDL_SetAtomicU32(&rb->tail, 0);
   return rb;
 }
 
 void ring_buffer_free(RingBuffer *rb) {
+  if (rb == NULL) {
+    return;
+  }
   SDL_free(rb->buffer);
   SDL_free(rb);
 }
 
-uint32_t ring_buffer_empty(RingBuffer *rb) { return rb->size == 0; }
+uint32_t ring_buffer_size(RingBuffer *rb) {
+  const uint32_t head = SDL_GetAtomicU32(&rb->head);
+  return SDL_GetAtomicU32(&rb->tail) - head;
+}
+
+uint32_t ring_buffer_empty(RingBuffer *rb) { return ring_buffer_size(rb) == 0; }
 
-uint32_t ring_buffer_full(RingBuffer *rb) { return rb->size == rb->max_size; }
+const uint8_t *ring_buffer_get_read_region(RingBuffer *rb, uint32_t *length) {
+  const uint32_t head = SDL_GetAtomicU32(&rb->head);
+  const uint32_t available = SDL_GetAtomicU32(&rb->tail) - head;
+  const uint32_t offset = head & rb->mask;
+
+  *length = SDL_min(available, rb->max_size - offset);
+  return rb->buffer + offset;
+}
+
+void ring_buffer_commit_read(RingBuffer *rb, uint32_t length) {
+  SDL_SetAtomicU32(&rb->head, SDL_GetAtomicU32(&rb->head) + length);
+}
+
+uint8_t *ring_buffer_get_write_region(RingBuffer *rb, uint32_t *length) {
+  const uint32_t tail = SDL_GetAtomicU32(&rb->tail);
+  const uint32_t free_space = rb->max_size - (tail - SDL_GetAtomicU32(&rb->head));
+  const uint32_t offset = tail & rb->mask;
+
+  *length = SDL_min(free_space, rb->max_size - offset);
+  return rb->buffer + offset;
+}
+
+void ring_buffer_commit_write(RingBuffer *rb, uint32_t length) {
+  SDL_SetAtomicU32(&rb->tail, SDL_GetAtomicU32(&rb->tail) + length);
+}
 
 uint32_t ring_buffer_push(RingBuffer *rb, const uint8_t *data, uint32_t length) {
-  if (ring_buffer_full(rb)) {
-    return -1; // buffer full, push fails
-  }
-  uint32_t space1 = rb->max_size - rb->tail;
-  uint32_t n = length <= rb->max_size - rb->size ? length : rb->max_size - rb->size;
-  if (n <= space1) {
-    SDL_memcpy(rb->buffer + rb->tail, data, n);
-  } else {
-    SDL_memcpy(rb->buffer + rb->tail, data, space1);
-    SDL_memcpy(rb->buffer, data + space1, n - space1);
+  uint32_t written = 0;
+
+  while (written < length) {
+    uint32_t space;
+    uint8_t *region = ring_buffer_get_write_region(rb, &space);
+    if (space == 0) {
+      break; // Full
+    }
+    const uint32_t n = SDL_min(space, length - written);
+    SDL_memcpy(region, data + written, n);
+    ring_buffer_commit_write(rb, n);
+    written += n;
   }
-  rb->tail = (rb->tail + n) % rb->max_size;
-  rb->size += n;
-  return n; // push successful, returns number of bytes pushed
+  return written;
 }
 
 uint32_t ring_buffer_pop(RingBuffer *rb, uint8_t *data, uint32_t length) {
-  if (ring_buffer_empty(rb)) {
-    return -1; // buffer empty, pop fails
-  }
-  uint32_t space1 = rb->max_size - rb->head;
-  uint32_t n = length <= rb->size ? length : rb->size;
-  if (n <= space1) {
-    SDL_memcpy(data, rb->buffer + rb->head, n);
-  } else {
-    SDL_memcpy(data, rb->buffer + rb->head, space1);
-    SDL_memcpy(data + space1, rb->buffer, n - space1);
+  uint32_t read = 0;
+
+  while (read < length) {
+    uint32_t available;
+    const uint8_t *region = ring_buffer_get_read_region(rb, &available);
+    if (available == 0) {
+      break; // Empty
+    }
+    const uint32_t n = SDL_min(available, length - read);
+    SDL_memcpy(data + read, region, n);
+    ring_buffer_commit_read(rb, n);
+    read += n;
   }
-  rb->head = (rb->head + n) % rb->max_size;
-  rb->size -= n;
-  return n; // pop successful, returns number of bytes popped
+  return read;
 }
@@ -1,24 +1,48 @@
 #ifndef M8C_RINGBUFFER_H
 #define M8C_RINGBUFFER_H
 
+#include <SDL3/SDL.h>
 #include <stdint.h>
 
+// Single-producer/single-consumer byte ring: one thread writes and another one reads, without
+// locks. head and tail count bytes since creation and are free to wrap around; the capacity is a
+// power of two so that they map into the buffer with a mask.
 typedef struct {
   uint8_t *buffer;
-  uint32_t head;
-  uint32_t tail;
-  uint32_t max_size;
-  uint32_t size;
+  uint32_t max_size; // Capacity, a power of two
+  uint32_t mask;
+
+  // Producer side
+  SDL_ALIGNED(SDL_CACHELINE_SIZE) SDL_AtomicU32 tail; // Bytes written
+
+  // Consumer side
+  SDL_ALIGNED(SDL_CACHELINE_SIZE) SDL_AtomicU32 head; // Bytes read
 } RingBuffer;
 
+// Create a ring holding at least size bytes. Returns NULL if out of memory.
 RingBuffer *ring_buffer_create(uint32_t size);
 
+void ring_buffer_free(RingBuffer *rb);
+
+// Bytes available for reading. Safe to call from either thread.
+uint32_t ring_buffer_size(RingBuffer *rb);
+
 uint32_t ring_buffer_empty(RingBuffer *rb);
 
+// Copy out up to length bytes. Returns the number of bytes read. Consumer thread only.
 uint32_t ring_buffer_pop(RingBuffer *rb, uint8_t *data, uint32_t length);
 
+// Copy in up to length bytes. Returns the number of bytes written, less than length if the ring
+// is full. Producer thread only.
 uint32_t ring_buffer_push(RingBuffer *rb, const uint8_t *data, uint32_t length);
 
-void ring_buffer_free(RingBuffer *rb);
+// Zero-copy access: get the contiguous part of the readable data (or the free space) at the
+// current position, use it in place and then commit how much of it was used. Reading or writing
+// everything available can take two rounds when the data wraps around the end of the buffer.
+// Read functions are for the consumer thread and write functions for the producer thread only.
+const uint8_t *ring_buffer_get_read_region(RingBuffer *rb, uint32_t *length);
+void ring_buffer_commit_read(RingBuffer *rb, uint32_t length);
+uint8_t *ring_buffer_get_write_region(RingBuffer *rb, uint32_t *length);
+void ring_buffer_commit_write(RingBuffer *rb, uint32_t length);
 
 #endif // M8C_RINGBUFFER_H
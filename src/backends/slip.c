@@ -27,9 +27,12 @@ It has been simplified a bit as CRC checking etc. is not required in this
 program. */
 
 #include "slip.h"
+#include "capture.h"
+#include "../stats.h"
 
 #include <assert.h>
 #include <stddef.h>
+#include <string.h>
 
 static void reset_rx(slip_handler_s *slip) {
   assert(slip != NULL);
@@ -45,11 +48,41 @@ slip_error_t slip_init(slip_handler_s *slip, const slip_descriptor_s *descriptor
   assert(descriptor->recv_message != NULL);
 
   slip->descriptor = descriptor;
+  slip->buf = NULL;
   reset_rx(slip);
 
   return SLIP_NO_ERROR;
 }
 
+// Pick the storage for a new frame. Storage from get_buffer is kept across errors and reused for
+// the next frame; it's only given up once a frame has been handed to recv_message.
+static uint8_t *frame_buffer(slip_handler_s *slip) {
+  if (slip->buf == NULL) {
+    if (slip->descriptor->get_buffer != NULL)
+      slip->buf = slip->descriptor->get_buffer(slip->descriptor->buf_size);
+    if (slip->buf == NULL)
+      slip->buf = slip->descriptor->buf;
+  }
+  return slip->buf;
+}
+
+// Hand a finished frame to recv_message and start a new one
+static slip_error_t end_frame(slip_handler_s *slip) {
+  slip_error_t error = SLIP_NO_ERROR;
+
+  /* Record before handing the frame over, the receiver may reuse its storage right away */
+  capture_frame(frame_buffer(slip), slip->size);
+
+  if (!slip->descriptor->recv_message(frame_buffer(slip), slip->size)) {
+    error = SLIP_ERROR_INVALID_PACKET;
+    stats_slip_error(STATS_SLIP_INVALID_PACKET);
+  }
+  slip->buf = NULL;
+  reset_rx(slip);
+
+  return error;
+}
+
 static slip_error_t put_byte_to_buffer(slip_handler_s *slip, const uint8_t byte) {
   slip_error_t error = SLIP_NO_ERROR;
 
@@ -57,9 +90,10 @@ static slip_error_t put_byte_to_buffer(slip_handler_s *slip, const uint8_t byte)
 
   if (slip->size >= slip->descriptor->buf_size) {
     error = SLIP_ERROR_BUFFER_OVERFLOW;
+    stats_slip_error(STATS_SLIP_BUFFER_OVERFLOW);
     reset_rx(slip);
   } else {
-    slip->descriptor->buf[slip->size++] = byte;
+    frame_buffer(slip)[slip->size++] = byte;
     slip->state = SLIP_STATE_NORMAL;
   }
 
@@ -75,10 +109,7 @@ slip_error_t slip_read_byte(slip_handler_s *slip, uint8_t byte) {
   case SLIP_STATE_NORMAL:
     switch (byte) {
     case SLIP_SPECIAL_BYTE_END:
-      if (!slip->descriptor->recv_message(slip->descriptor->buf, slip->size)) {
-        error = SLIP_ERROR_INVALID_PACKET;
-      }
-      reset_rx(slip);
+      error = end_frame(slip);
       break;
     case SLIP_SPECIAL_BYTE_ESC:
       slip->state = SLIP_STATE_ESCAPED;
@@ -99,6 +130,7 @@ slip_error_t slip_read_byte(slip_handler_s *slip, uint8_t byte) {
       break;
     default:
       error = SLIP_ERROR_UNKNOWN_ESCAPED_BYTE;
+      stats_slip_error(STATS_SLIP_UNKNOWN_ESCAPED_BYTE);
       reset_rx(slip);
       break;
     }
@@ -112,3 +144,76 @@ slip_error_t slip_read_byte(slip_handler_s *slip, uint8_t byte) {
 
   return error;
 }
+
+// Append a run of plain bytes to the frame buffer. Mirrors put_byte_to_buffer(): on overflow the
+// byte that doesn't fit is dropped and a new frame is started with the remaining bytes.
+static slip_error_t put_run_to_buffer(slip_handler_s *slip, const uint8_t *run, uint32_t length) {
+  slip_error_t error = SLIP_NO_ERROR;
+  uint8_t *buf = length > 0 ? frame_buffer(slip) : NULL;
+
+  while (length > 0) {
+    const uint32_t room = slip->descriptor->buf_size - slip->size;
+    if (length <= room) {
+      memcpy(buf + slip->size, run, length);
+      slip->size += length;
+      break;
+    }
+    memcpy(buf + slip->size, run, room);
+    run += room + 1;
+    length -= room + 1;
+    error = SLIP_ERROR_BUFFER_OVERFLOW;
+    stats_slip_error(STATS_SLIP_BUFFER_OVERFLOW);
+    reset_rx(slip);
+  }
+
+  return error;
+}
+
+slip_error_t slip_read_buffer(slip_handler_s *slip, const uint8_t *data, uint32_t size) {
+  slip_error_t error = SLIP_NO_ERROR;
+  slip_error_t result;
+  const uint8_t *end = data + size;
+  const uint8_t *frame_end = NULL;
+
+  assert(slip != NULL);
+  assert(data != NULL || size == 0);
+
+  stats_bytes_received(size);
+
+  while (data < end) {
+    if (slip->state == SLIP_STATE_ESCAPED) {
+      result = slip_read_byte(slip, *data++);
+      if (error == SLIP_NO_ERROR)
+        error = result;
+      continue;
+    }
+
+    // Locate the next END once per frame, then look for escapes only up to it
+    if (frame_end == NULL || frame_end < data) {
+      frame_end = memchr(data, SLIP_SPECIAL_BYTE_END, end - data);
+      if (frame_end == NULL)
+        frame_end = end;
+    }
+    const uint8_t *escape = memchr(data, SLIP_SPECIAL_BYTE_ESC, frame_end - data);
+    const uint8_t *special = escape != NULL ? escape : frame_end;
+
+    result = put_run_to_buffer(slip, data, (uint32_t)(special - data));
+    if (error == SLIP_NO_ERROR)
+      error = result;
+
+    data = special;
+    if (data == end)
+      break;
+
+    if (*data == SLIP_SPECIAL_BYTE_END) {
+      result = end_frame(slip);
+      if (error == SLIP_NO_ERROR)
+        error = result;
+    } else {
+      slip->state = SLIP_STATE_ESCAPED;
+    }
+    data++;
+  }
+
+  return error;
+}
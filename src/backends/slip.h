@@ -46,11 +46,15 @@ typedef struct {
         uint8_t *buf;
         uint32_t buf_size;
         int (*recv_message)(uint8_t *data, uint32_t size);
+        /* Optional: storage for the next frame, at least size bytes. Lets frames be decoded
+        straight into their destination. Falls back to buf when NULL or when it returns NULL. */
+        uint8_t *(*get_buffer)(uint32_t size);
 } slip_descriptor_s;
 
 typedef struct {
         slip_state_t state;
         uint32_t size;
+        uint8_t *buf; /* storage for the frame being decoded, NULL until its first byte */
         const slip_descriptor_s *descriptor;
 } slip_handler_s;
 
@@ -63,5 +67,9 @@ typedef enum {
 
 slip_error_t slip_init(slip_handler_s *slip, const slip_descriptor_s *descriptor);
 slip_error_t slip_read_byte(slip_handler_s *slip, uint8_t byte);
+/* Decode a whole buffer at once. Plain runs are copied in bulk and recv_message is called once
+per frame. Decoder state carries across calls. Returns the first error encountered; decoding
+continues past errors like repeated slip_read_byte() calls would. */
+slip_error_t slip_read_buffer(slip_handler_s *slip, const uint8_t *data, uint32_t size);
 
 #endif
\ No newline at end of file
@@ -4,7 +4,9 @@
 #include <SDL3/SDL.h>
 
 #include "command.h"
+#include "log_pipeline.h"
 #include "render.h"
+#include "stats.h"
 #include <assert.h>
 
 #define ArrayCount(x) sizeof(x) / sizeof((x)[1])
@@ -32,10 +34,7 @@ enum m8_command_bytes {
 };
 
 static void dump_packet(const uint32_t size, const uint8_t *recv_buf) {
-  for (uint32_t a = 0; a < size; a++) {
-    SDL_LogDebug(SDL_LOG_CATEGORY_APPLICATION, "0x%02X ", recv_buf[a]);
-  }
-  SDL_LogDebug(SDL_LOG_CATEGORY_APPLICATION, "\n");
+  log_packet(SDL_LOG_CATEGORY_APPLICATION, recv_buf, size);
 }
 
 int process_command(const uint8_t *recv_buf, uint32_t size) {
@@ -53,6 +52,7 @@ int process_command(const uint8_t *recv_buf, uint32_t size) {
                    draw_rectangle_command_pos_color_datalength,
                    draw_rectangle_command_pos_size_datalength,
                    draw_rectangle_command_pos_size_color_datalength, size);
+      stats_command(STATS_COMMAND_INVALID);
       dump_packet(size, recv_buf);
       return 0;
     }
@@ -94,6 +94,7 @@ int process_command(const uint8_t *recv_buf, uint32_t size) {
       return 0;
     }
 
+    stats_command(STATS_COMMAND_RECTANGLE);
     draw_rectangle(&rectcmd);
     return 1;
   }
@@ -103,6 +104,7 @@ int process_command(const uint8_t *recv_buf, uint32_t size) {
       SDL_LogError(SDL_LOG_CATEGORY_ERROR,
                    "Invalid draw character packet: expected length %d, got %d",
                    draw_character_command_datalength, size);
+      stats_command(STATS_COMMAND_INVALID);
       dump_packet(size, recv_buf);
       return 0;
     }
@@ -111,6 +113,7 @@ int process_command(const uint8_t *recv_buf, uint32_t size) {
         {decodeInt16(recv_buf, 2), decodeInt16(recv_buf, 4)}, // position x/y
         {recv_buf[6], recv_buf[7], recv_buf[8]},              // foreground r/g/b
         {recv_buf[9], recv_buf[10], recv_buf[11]}};           // background r/g/b
+    stats_command(STATS_COMMAND_CHARACTER);
     draw_character(&charcmd);
     return 1;
   }
@@ -122,6 +125,7 @@ int process_command(const uint8_t *recv_buf, uint32_t size) {
                    "Invalid draw oscilloscope packet: expected length between %d and %d, got %d",
                    draw_oscilloscope_waveform_command_mindatalength,
                    draw_oscilloscope_waveform_command_maxdatalength, size);
+      stats_command(STATS_COMMAND_INVALID);
       dump_packet(size, recv_buf);
       return 0;
     }
@@ -132,6 +136,7 @@ int process_command(const uint8_t *recv_buf, uint32_t size) {
 
     osccmd.waveform_size = (size & UINT16_MAX) - 4;
 
+    stats_command(STATS_COMMAND_WAVEFORM);
     draw_waveform(&osccmd);
     return 1;
   }
@@ -142,11 +147,13 @@ int process_command(const uint8_t *recv_buf, uint32_t size) {
                    "Invalid joypad keypressed state packet: expected length %d, "
                    "got %d\n",
                    joypad_keypressedstate_command_datalength, size);
+      stats_command(STATS_COMMAND_INVALID);
       dump_packet(size, recv_buf);
       return 0;
     }
 
     // nothing is done with joypad key pressed packets for now
+    stats_command(STATS_COMMAND_JOYPAD);
     return 1;
   }
 
@@ -155,10 +162,13 @@ int process_command(const uint8_t *recv_buf, uint32_t size) {
       SDL_LogError(SDL_LOG_CATEGORY_ERROR,
                    "Invalid system info packet: expected length %d, got %d\n",
                    system_info_command_datalength, size);
+      stats_command(STATS_COMMAND_INVALID);
       dump_packet(size, recv_buf);
       break;
     }
 
+    stats_command(STATS_COMMAND_SYSTEM_INFO);
+
     char *hwtype[4] = {"Headless", "Beta M8", "Production M8", "Production M8 Model:02"};
 
     static int system_info_printed = 0;
@@ -183,6 +193,7 @@ int process_command(const uint8_t *recv_buf, uint32_t size) {
 
   default:
     SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Invalid packet");
+    stats_command(STATS_COMMAND_INVALID);
     dump_packet(size, recv_buf);
     return 0;
   }
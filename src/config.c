@@ -2,6 +2,7 @@
 // Released under the MIT licence, https://opensource.org/licenses/MIT
 
 #include "config.h"
+#include "frame_pacing.h"
 #include "ini.h"
 #include <SDL3/SDL.h>
 #include <assert.h>
@@ -30,9 +31,19 @@ config_params_s config_initialize(char *filename) {
 
   c.init_fullscreen = 0; // default fullscreen state at load
   c.integer_scaling = 0; // use integer scaling for the user interface
-  c.wait_packets = 256;  // amount of empty command queue reads before assuming device disconnected
+  c.framebuffer_renderer = 0; // rasterize the screen on the CPU and upload only changed regions
+  c.frame_pacing = FRAME_PACING_VSYNC; // when to present: vsync, low_latency or power_saving
+  c.power_saving_fps = 30;             // frame rate in power saving mode
+  c.video_record_raw = 0;   // screen recordings as raw BGRA frames instead of YUV4MPEG2
+  c.video_record_fps = 60;  // frame rate of screen recordings
+  c.wait_packets = 256;  // empty command queue reads at 120 Hz before checking the device is there
+  c.serial_event_driven = 1; // wake the serial reader on incoming data instead of polling
+  c.usb_read_transfers = 4;  // libusb: number of display data reads kept in flight
   c.audio_enabled = 0;   // route M8 audio to default output
   c.audio_buffer_size = 0;    // requested audio buffer size in samples: 0 = let SDL decide
+  c.audio_latency_ms = 0;     // amount of M8 audio kept buffered: 0 = backend default
+  c.audio_passthrough = 0;    // forward audio as soon as it is captured, for live monitoring
+  c.audio_record_raw = 0;     // audio recordings as raw PCM instead of WAV
   c.audio_device_name = NULL; // Use this device, leave NULL to use the default output device
 
   c.key_up = SDL_SCANCODE_UP;
@@ -54,8 +65,11 @@ config_params_s config_initialize(char *filename) {
   c.key_jazz_inc_velocity = SDL_SCANCODE_KP_PLUS;
   c.key_jazz_dec_velocity = SDL_SCANCODE_KP_MINUS;
   c.key_toggle_audio = SDL_SCANCODE_F12;
+  c.key_toggle_audio_record = SDL_SCANCODE_F11;
+  c.key_toggle_video_record = SDL_SCANCODE_F10;
   c.key_toggle_settings = SDL_SCANCODE_F1;
   c.key_toggle_log = SDL_SCANCODE_F2;
+  c.key_toggle_stats = SDL_SCANCODE_F3;
 
   c.gamepad_up = SDL_GAMEPAD_BUTTON_DPAD_UP;
   c.gamepad_left = SDL_GAMEPAD_BUTTON_DPAD_LEFT;
@@ -80,6 +94,12 @@ config_params_s config_initialize(char *filename) {
   return c;
 }
 
+unsigned int config_device_timeout_ms(const config_params_s *conf) {
+  // wait_packets predates the frame pacing modes and counts iterations of a 120 Hz main loop.
+  // The loop rate depends on the mode now, so the count is converted to the time it stood for.
+  return conf->wait_packets * 1000 / 120;
+}
+
 // Write config to file
 void write_config(const config_params_s *conf) {
 
@@ -90,7 +110,7 @@ void write_config(const config_params_s *conf) {
 
   SDL_Log("Writing config file to %s", config_path);
 
-#define INI_LINE_COUNT 50
+#define INI_LINE_COUNT 63
 #define INI_LINE_LENGTH 50
 
   // Entries for the config file
@@ -100,13 +120,33 @@ void write_config(const config_params_s *conf) {
   snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "fullscreen=%s\n",
            conf->init_fullscreen ? "true" : "false");
   snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "wait_packets=%d\n", conf->wait_packets);
+  snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "serial_event_driven=%s\n",
+           conf->serial_event_driven ? "true" : "false");
+  snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "usb_read_transfers=%d\n",
+           conf->usb_read_transfers);
   snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "integer_scaling=%s\n",
            conf->integer_scaling ? "true" : "false");
+  snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "framebuffer_renderer=%s\n",
+           conf->framebuffer_renderer ? "true" : "false");
+  snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "frame_pacing=%s\n",
+           frame_pacing_mode_name(conf->frame_pacing));
+  snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "power_saving_fps=%d\n",
+           conf->power_saving_fps);
+  snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "video_record_format=%s\n",
+           conf->video_record_raw ? "raw" : "y4m");
+  snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "video_record_fps=%d\n",
+           conf->video_record_fps);
   snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "[audio]\n");
   snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "audio_enabled=%s\n",
            conf->audio_enabled ? "true" : "false");
   snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "audio_buffer_size=%d\n",
            conf->audio_buffer_size);
+  snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "audio_latency_ms=%d\n",
+           conf->audio_latency_ms);
+  snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "audio_passthrough=%s\n",
+           conf->audio_passthrough ? "true" : "false");
+  snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "audio_record_format=%s\n",
+           conf->audio_record_raw ? "raw" : "wav");
   snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "audio_device_name=%s\n",
            conf->audio_device_name ? conf->audio_device_name : "Default");
   snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "[keyboard]\n");
@@ -136,8 +176,14 @@ void write_config(const config_params_s *conf) {
            conf->key_jazz_dec_velocity);
   snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "key_toggle_audio=%d\n",
            conf->key_toggle_audio);
+  snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "key_toggle_audio_record=%d\n",
+           conf->key_toggle_audio_record);
+  snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "key_toggle_video_record=%d\n",
+           conf->key_toggle_video_record);
   snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "key_toggle_settings=%d\n", conf->key_toggle_settings);
   snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "key_toggle_log=%d\n", conf->key_toggle_log);
+  snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "key_toggle_stats=%d\n",
+           conf->key_toggle_stats);
   snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "[gamepad]\n");
   snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "gamepad_up=%d\n", conf->gamepad_up);
   snprintf(ini_values[initPointer++], INI_LINE_LENGTH, "gamepad_left=%d\n", conf->gamepad_left);
@@ -213,6 +259,9 @@ void config_read(config_params_s *conf) {
 void read_audio_config(const ini_t *ini, config_params_s *conf) {
   const char *param_audio_enabled = ini_get(ini, "audio", "audio_enabled");
   const char *param_audio_buffer_size = ini_get(ini, "audio", "audio_buffer_size");
+  const char *param_audio_latency_ms = ini_get(ini, "audio", "audio_latency_ms");
+  const char *param_audio_passthrough = ini_get(ini, "audio", "audio_passthrough");
+  const char *param_audio_record_format = ini_get(ini, "audio", "audio_record_format");
   const char *param_audio_device_name = ini_get(ini, "audio", "audio_device_name");
 
   if (param_audio_enabled != NULL) {
@@ -230,12 +279,39 @@ void read_audio_config(const ini_t *ini, config_params_s *conf) {
   if (param_audio_buffer_size != NULL) {
     conf->audio_buffer_size = SDL_atoi(param_audio_buffer_size);
   }
+
+  if (param_audio_latency_ms != NULL) {
+    conf->audio_latency_ms = SDL_atoi(param_audio_latency_ms);
+  }
+
+  if (param_audio_passthrough != NULL) {
+    if (strcmpci(param_audio_passthrough, "true") == 0) {
+      conf->audio_passthrough = 1;
+    } else {
+      conf->audio_passthrough = 0;
+    }
+  }
+
+  if (param_audio_record_format != NULL) {
+    if (strcmpci(param_audio_record_format, "raw") == 0) {
+      conf->audio_record_raw = 1;
+    } else {
+      conf->audio_record_raw = 0;
+    }
+  }
 }
 
 void read_graphics_config(const ini_t *ini, config_params_s *conf) {
   const char *param_fs = ini_get(ini, "graphics", "fullscreen");
   const char *wait_packets = ini_get(ini, "graphics", "wait_packets");
+  const char *serial_event_driven = ini_get(ini, "graphics", "serial_event_driven");
+  const char *usb_read_transfers = ini_get(ini, "graphics", "usb_read_transfers");
   const char *integer_scaling = ini_get(ini, "graphics", "integer_scaling");
+  const char *framebuffer_renderer = ini_get(ini, "graphics", "framebuffer_renderer");
+  const char *frame_pacing = ini_get(ini, "graphics", "frame_pacing");
+  const char *power_saving_fps = ini_get(ini, "graphics", "power_saving_fps");
+  const char *video_record_format = ini_get(ini, "graphics", "video_record_format");
+  const char *video_record_fps = ini_get(ini, "graphics", "video_record_fps");
 
   if (param_fs != NULL && strcmpci(param_fs, "true") == 0) {
     conf->init_fullscreen = 1;
@@ -246,11 +322,43 @@ void read_graphics_config(const ini_t *ini, config_params_s *conf) {
   if (wait_packets != NULL)
     conf->wait_packets = SDL_atoi(wait_packets);
 
+  if (serial_event_driven != NULL && strcmpci(serial_event_driven, "false") == 0) {
+    conf->serial_event_driven = 0;
+  } else {
+    conf->serial_event_driven = 1;
+  }
+
+  if (usb_read_transfers != NULL)
+    conf->usb_read_transfers = SDL_atoi(usb_read_transfers);
+
   if (integer_scaling != NULL && strcmpci(integer_scaling, "true") == 0) {
     conf->integer_scaling = 1;
   } else {
     conf->integer_scaling = 0;
   }
+
+  if (framebuffer_renderer != NULL && strcmpci(framebuffer_renderer, "true") == 0) {
+    conf->framebuffer_renderer = 1;
+  } else {
+    conf->framebuffer_renderer = 0;
+  }
+
+  if (frame_pacing != NULL)
+    conf->frame_pacing = frame_pacing_mode_from_name(frame_pacing);
+
+  if (power_saving_fps != NULL)
+    conf->power_saving_fps = SDL_atoi(power_saving_fps);
+
+  if (video_record_format != NULL) {
+    if (strcmpci(video_record_format, "raw") == 0) {
+      conf->video_record_raw = 1;
+    } else {
+      conf->video_record_raw = 0;
+    }
+  }
+
+  if (video_record_fps != NULL)
+    conf->video_record_fps = SDL_atoi(video_record_fps);
 }
 
 void read_key_config(const ini_t *ini, config_params_s *conf) {
@@ -275,8 +383,11 @@ void read_key_config(const ini_t *ini, config_params_s *conf) {
   const char *key_jazz_inc_velocity = ini_get(ini, "keyboard", "key_jazz_inc_velocity");
   const char *key_jazz_dec_velocity = ini_get(ini, "keyboard", "key_jazz_dec_velocity");
   const char *key_toggle_audio = ini_get(ini, "keyboard", "key_toggle_audio");
+  const char *key_toggle_audio_record = ini_get(ini, "keyboard", "key_toggle_audio_record");
+  const char *key_toggle_video_record = ini_get(ini, "keyboard", "key_toggle_video_record");
   const char *key_toggle_settings = ini_get(ini, "keyboard", "key_toggle_settings");
   const char *key_toggle_log = ini_get(ini, "keyboard", "key_toggle_log");
+  const char *key_toggle_stats = ini_get(ini, "keyboard", "key_toggle_stats");
 
   if (key_up)
     conf->key_up = SDL_atoi(key_up);
@@ -316,10 +427,16 @@ void read_key_config(const ini_t *ini, config_params_s *conf) {
     conf->key_jazz_dec_velocity = SDL_atoi(key_jazz_dec_velocity);
   if (key_toggle_audio)
     conf->key_toggle_audio = SDL_atoi(key_toggle_audio);
+  if (key_toggle_audio_record)
+    conf->key_toggle_audio_record = SDL_atoi(key_toggle_audio_record);
+  if (key_toggle_video_record)
+    conf->key_toggle_video_record = SDL_atoi(key_toggle_video_record);
   if (key_toggle_settings)
     conf->key_toggle_log = SDL_atoi(key_toggle_settings);
   if (key_toggle_log)
     conf->key_toggle_log = SDL_atoi(key_toggle_log);
+  if (key_toggle_stats)
+    conf->key_toggle_stats = SDL_atoi(key_toggle_stats);
 }
 
 void read_gamepad_config(const ini_t *ini, config_params_s *conf) {
@@ -10,9 +10,19 @@ typedef struct config_params_s {
   char *filename;
   unsigned int init_fullscreen;
   unsigned int integer_scaling;
+  unsigned int framebuffer_renderer;
+  unsigned int frame_pacing;
+  unsigned int power_saving_fps;
+  unsigned int video_record_raw;
+  unsigned int video_record_fps;
   unsigned int wait_packets;
+  unsigned int serial_event_driven;
+  unsigned int usb_read_transfers;
   unsigned int audio_enabled;
   unsigned int audio_buffer_size;
+  unsigned int audio_latency_ms;
+  unsigned int audio_passthrough;
+  unsigned int audio_record_raw;
   char *audio_device_name;
 
   unsigned int key_up;
@@ -34,8 +44,11 @@ typedef struct config_params_s {
   unsigned int key_jazz_inc_velocity;
   unsigned int key_jazz_dec_velocity;
   unsigned int key_toggle_audio;
+  unsigned int key_toggle_audio_record;
+  unsigned int key_toggle_video_record;
   unsigned int key_toggle_settings;
   unsigned int key_toggle_log;
+  unsigned int key_toggle_stats;
 
   int gamepad_up;
   int gamepad_left;
@@ -66,6 +79,9 @@ void read_graphics_config(const ini_t *ini, config_params_s *conf);
 void read_key_config(const ini_t *ini, config_params_s *conf);
 void read_gamepad_config(const ini_t *ini, config_params_s *conf);
 
+// Time without messages from the device before checking that it is still connected
+unsigned int config_device_timeout_ms(const config_params_s *conf);
+
 // Expose write so settings UI can persist changes
 void write_config(const config_params_s *conf);
 
@@ -0,0 +1,386 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#include "draw_batch.h"
+
+// Largest M8 screen (Model:02)
+#define DRAW_BATCH_MAX_WIDTH 480
+#define DRAW_BATCH_MAX_HEIGHT 320
+
+#define DRAW_BATCH_MAX_COMMANDS 4096
+#define DRAW_BATCH_MAX_ITEMS (DRAW_BATCH_MAX_COMMANDS * 2)
+#define DRAW_BATCH_MAX_GROUPS 256
+
+// Overlap between draws is tracked per tile, which is coarse but never misses an overlap
+#define TILE_SIZE 8
+#define TILES_X (DRAW_BATCH_MAX_WIDTH / TILE_SIZE)
+#define TILES_Y (DRAW_BATCH_MAX_HEIGHT / TILE_SIZE)
+
+#define COVERAGE_WORDS ((DRAW_BATCH_MAX_WIDTH + 63) / 64)
+
+enum group_kind { GROUP_RECTS, GROUP_GLYPHS };
+
+typedef struct {
+  SDL_FRect rect;         // Rectangle or character background
+  SDL_FRect glyph;        // Character glyph destination
+  SDL_FRect glyph_source; // Character glyph location in the font texture
+  SDL_Color color;
+  SDL_Color glyph_color;
+  Uint8 has_rect;
+  Uint8 has_glyph;
+  Uint8 visible; // Not completely overwritten by a later command
+} batch_command_s;
+
+// One render call: rectangles of a single color, or glyphs colored per vertex
+typedef struct {
+  Uint8 kind;
+  SDL_Color color;
+  int count;
+  int first;     // Offset of the group's output in the rect or vertex buffer
+  int last_item; // For merging a rectangle with the previous one in the group
+} batch_group_s;
+
+typedef struct {
+  SDL_FRect rect; // Rectangle to fill, unused for glyphs
+  int command;
+  int group;
+} batch_item_s;
+
+typedef struct {
+  int x0, y0, x1, y1;
+} bounds_s;
+
+static batch_command_s commands[DRAW_BATCH_MAX_COMMANDS];
+static int command_count = 0;
+
+static batch_group_s groups[DRAW_BATCH_MAX_GROUPS];
+static int group_count = 0;
+static batch_item_s items[DRAW_BATCH_MAX_ITEMS];
+static int item_count = 0;
+
+static Uint16 tiles[TILES_Y][TILES_X]; // Latest group drawing to each tile, plus one
+static Uint64 coverage[DRAW_BATCH_MAX_HEIGHT][COVERAGE_WORDS]; // Pixels overwritten later
+
+static SDL_FRect rect_buffer[DRAW_BATCH_MAX_ITEMS];
+static SDL_Vertex vertex_buffer[DRAW_BATCH_MAX_COMMANDS * 4];
+static int index_buffer[DRAW_BATCH_MAX_COMMANDS * 6];
+
+static struct {
+  Uint32 commands;
+  Uint32 culled;
+  Uint32 draw_calls;
+} stats;
+static Uint64 total_draw_calls = 0;
+
+static int clip_rect(const SDL_FRect *rect, int width, int height, bounds_s *bounds) {
+  bounds->x0 = SDL_max((int)rect->x, 0);
+  bounds->y0 = SDL_max((int)rect->y, 0);
+  bounds->x1 = SDL_min((int)(rect->x + rect->w), width);
+  bounds->y1 = SDL_min((int)(rect->y + rect->h), height);
+  return bounds->x0 < bounds->x1 && bounds->y0 < bounds->y1;
+}
+
+static int command_bounds(const batch_command_s *command, int width, int height,
+                          bounds_s *bounds) {
+  bounds_s glyph_bounds;
+  int visible = command->has_rect && clip_rect(&command->rect, width, height, bounds);
+
+  if (command->has_glyph && clip_rect(&command->glyph, width, height, &glyph_bounds)) {
+    if (visible) {
+      bounds->x0 = SDL_min(bounds->x0, glyph_bounds.x0);
+      bounds->y0 = SDL_min(bounds->y0, glyph_bounds.y0);
+      bounds->x1 = SDL_max(bounds->x1, glyph_bounds.x1);
+      bounds->y1 = SDL_max(bounds->y1, glyph_bounds.y1);
+    } else {
+      *bounds = glyph_bounds;
+      visible = 1;
+    }
+  }
+  return visible;
+}
+
+// Bits x0..x1-1 of a coverage word
+static Uint64 word_mask(int word, int x0, int x1) {
+  const int first = SDL_max(x0 - word * 64, 0);
+  const int last = SDL_min(x1 - word * 64, 64);
+  const Uint64 high = last == 64 ? ~(Uint64)0 : ((Uint64)1 << last) - 1;
+  return high & ~(((Uint64)1 << first) - 1);
+}
+
+static int region_covered(const bounds_s *bounds) {
+  for (int y = bounds->y0; y < bounds->y1; y++) {
+    for (int word = bounds->x0 / 64; word <= (bounds->x1 - 1) / 64; word++) {
+      const Uint64 mask = word_mask(word, bounds->x0, bounds->x1);
+      if ((coverage[y][word] & mask) != mask) {
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+static void cover_region(const bounds_s *bounds) {
+  for (int y = bounds->y0; y < bounds->y1; y++) {
+    for (int word = bounds->x0 / 64; word <= (bounds->x1 - 1) / 64; word++) {
+      coverage[y][word] |= word_mask(word, bounds->x0, bounds->x1);
+    }
+  }
+}
+
+// Walk the batch backwards and drop commands whose pixels are all overwritten later on
+static void cull_overwritten_commands(int width, int height) {
+  for (int y = 0; y < height; y++) {
+    SDL_memset(coverage[y], 0, sizeof(coverage[y]));
+  }
+
+  for (int i = command_count - 1; i >= 0; i--) {
+    batch_command_s *command = &commands[i];
+    bounds_s bounds;
+
+    if (!command_bounds(command, width, height, &bounds) || region_covered(&bounds)) {
+      command->visible = 0;
+      stats.culled++;
+      continue;
+    }
+    command->visible = 1;
+
+    // Only rectangles and character backgrounds are opaque
+    if (command->has_rect && clip_rect(&command->rect, width, height, &bounds)) {
+      cover_region(&bounds);
+    }
+  }
+}
+
+static int merge_rects(SDL_FRect *into, const SDL_FRect *rect) {
+  if (into->y == rect->y && into->h == rect->h && into->x + into->w == rect->x) {
+    into->w += rect->w;
+    return 1;
+  }
+  if (into->x == rect->x && into->w == rect->w && into->y + into->h == rect->y) {
+    into->h += rect->h;
+    return 1;
+  }
+  return 0;
+}
+
+static void emit_groups(SDL_Renderer *renderer, SDL_Texture *font) {
+  float font_w = 1, font_h = 1;
+  if (font != NULL) {
+    SDL_GetTextureSize(font, &font_w, &font_h);
+  }
+
+  // Lay out each group's output contiguously, keeping the order of items within a group
+  int rect_total = 0, glyph_total = 0;
+  for (int g = 0; g < group_count; g++) {
+    if (groups[g].kind == GROUP_RECTS) {
+      groups[g].first = rect_total;
+      rect_total += groups[g].count;
+    } else {
+      groups[g].first = glyph_total;
+      glyph_total += groups[g].count;
+    }
+    groups[g].count = 0;
+  }
+
+  for (int i = 0; i < item_count; i++) {
+    batch_group_s *group = &groups[items[i].group];
+    const int slot = group->first + group->count++;
+
+    if (group->kind == GROUP_RECTS) {
+      rect_buffer[slot] = items[i].rect;
+      continue;
+    }
+
+    const batch_command_s *command = &commands[items[i].command];
+    const SDL_FRect *dst = &command->glyph;
+    const SDL_FRect *src = &command->glyph_source;
+    const SDL_FColor color = {command->glyph_color.r / 255.0f, command->glyph_color.g / 255.0f,
+                              command->glyph_color.b / 255.0f, 1.0f};
+    SDL_Vertex *v = &vertex_buffer[slot * 4];
+
+    v[0] = (SDL_Vertex){{dst->x, dst->y}, color, {src->x / font_w, src->y / font_h}};
+    v[1] = (SDL_Vertex){{dst->x + dst->w, dst->y},
+                        color,
+                        {(src->x + src->w) / font_w, src->y / font_h}};
+    v[2] = (SDL_Vertex){{dst->x + dst->w, dst->y + dst->h},
+                        color,
+                        {(src->x + src->w) / font_w, (src->y + src->h) / font_h}};
+    v[3] = (SDL_Vertex){{dst->x, dst->y + dst->h},
+                        color,
+                        {src->x / font_w, (src->y + src->h) / font_h}};
+  }
+
+  for (int g = 0; g < group_count; g++) {
+    const batch_group_s *group = &groups[g];
+    if (group->kind == GROUP_RECTS) {
+      SDL_SetRenderDrawColor(renderer, group->color.r, group->color.g, group->color.b, 0xFF);
+      SDL_RenderFillRects(renderer, &rect_buffer[group->first], group->count);
+    } else if (font != NULL) {
+      SDL_RenderGeometry(renderer, font, &vertex_buffer[group->first * 4], group->count * 4,
+                         index_buffer, group->count * 6);
+    }
+    stats.draw_calls++;
+    total_draw_calls++;
+  }
+
+  group_count = 0;
+  item_count = 0;
+  SDL_memset(tiles, 0, sizeof(tiles));
+}
+
+// Put a draw into the latest suitable group that comes after every group it overlaps
+static void add_item(SDL_Renderer *renderer, SDL_Texture *font, const bounds_s *bounds,
+                     Uint8 kind, SDL_Color color, const SDL_FRect *rect, int command) {
+  const int tx0 = bounds->x0 / TILE_SIZE, tx1 = (bounds->x1 - 1) / TILE_SIZE;
+  const int ty0 = bounds->y0 / TILE_SIZE, ty1 = (bounds->y1 - 1) / TILE_SIZE;
+
+  int earliest = 0;
+  for (int ty = ty0; ty <= ty1; ty++) {
+    for (int tx = tx0; tx <= tx1; tx++) {
+      earliest = SDL_max(earliest, tiles[ty][tx]);
+    }
+  }
+  earliest = SDL_max(earliest - 1, 0);
+
+  int g = group_count - 1;
+  for (; g >= earliest; g--) {
+    if (groups[g].kind == kind &&
+        (kind == GROUP_GLYPHS || (groups[g].color.r == color.r && groups[g].color.g == color.g &&
+                                  groups[g].color.b == color.b))) {
+      break;
+    }
+  }
+
+  if (g < earliest) {
+    if (group_count == DRAW_BATCH_MAX_GROUPS) {
+      emit_groups(renderer, font);
+    }
+    g = group_count++;
+    groups[g] = (batch_group_s){kind, color, 0, 0, -1};
+  }
+
+  // Extend the previous rectangle of the group if they line up
+  if (kind != GROUP_RECTS || groups[g].last_item < 0 ||
+      !merge_rects(&items[groups[g].last_item].rect, rect)) {
+    items[item_count] = (batch_item_s){kind == GROUP_RECTS ? *rect : (SDL_FRect){0}, command, g};
+    groups[g].last_item = item_count++;
+    groups[g].count++;
+  }
+
+  for (int ty = ty0; ty <= ty1; ty++) {
+    for (int tx = tx0; tx <= tx1; tx++) {
+      tiles[ty][tx] = (Uint16)SDL_max(tiles[ty][tx], g + 1);
+    }
+  }
+}
+
+static batch_command_s *next_command(void) {
+  if (command_count == DRAW_BATCH_MAX_COMMANDS) {
+    return NULL;
+  }
+  stats.commands++;
+  return &commands[command_count++];
+}
+
+int draw_batch_is_full(void) { return command_count == DRAW_BATCH_MAX_COMMANDS; }
+
+void draw_batch_rect(const SDL_FRect *rect, SDL_Color color) {
+  batch_command_s *command = next_command();
+  if (command == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Draw batch full, rectangle dropped");
+    return;
+  }
+  command->rect = *rect;
+  command->color = color;
+  command->has_rect = 1;
+  command->has_glyph = 0;
+}
+
+void draw_batch_character(const SDL_FRect *background, SDL_Color background_color,
+                          const SDL_FRect *glyph, const SDL_FRect *glyph_source,
+                          SDL_Color glyph_color) {
+  batch_command_s *command = next_command();
+  if (command == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Draw batch full, character dropped");
+    return;
+  }
+  command->has_rect = background != NULL;
+  if (background != NULL) {
+    command->rect = *background;
+    command->color = background_color;
+  }
+  command->has_glyph = glyph_source != NULL;
+  if (glyph_source != NULL) {
+    command->glyph = *glyph;
+    command->glyph_source = *glyph_source;
+    command->glyph_color = glyph_color;
+  }
+}
+
+void draw_batch_flush(SDL_Renderer *renderer, SDL_Texture *font, int target_width,
+                      int target_height) {
+  if (command_count == 0) {
+    return;
+  }
+
+  const int width = SDL_min(target_width, DRAW_BATCH_MAX_WIDTH);
+  const int height = SDL_min(target_height, DRAW_BATCH_MAX_HEIGHT);
+
+  static int index_buffer_ready = 0;
+  if (!index_buffer_ready) {
+    index_buffer_ready = 1;
+    for (int i = 0; i < DRAW_BATCH_MAX_COMMANDS; i++) {
+      const int quad[6] = {0, 1, 2, 0, 2, 3};
+      for (int j = 0; j < 6; j++) {
+        index_buffer[i * 6 + j] = i * 4 + quad[j];
+      }
+    }
+  }
+
+  // Glyph colors come from the vertices, so the color modulation inprint() uses must not apply
+  Uint8 mod_r = 0xFF, mod_g = 0xFF, mod_b = 0xFF;
+  if (font != NULL) {
+    SDL_GetTextureColorMod(font, &mod_r, &mod_g, &mod_b);
+    SDL_SetTextureColorMod(font, 0xFF, 0xFF, 0xFF);
+  }
+
+  cull_overwritten_commands(width, height);
+
+  for (int i = 0; i < command_count; i++) {
+    const batch_command_s *command = &commands[i];
+    bounds_s bounds;
+    if (!command->visible) {
+      continue;
+    }
+    if (command->has_rect && clip_rect(&command->rect, width, height, &bounds)) {
+      add_item(renderer, font, &bounds, GROUP_RECTS, command->color, &command->rect, i);
+    }
+    if (command->has_glyph && clip_rect(&command->glyph, width, height, &bounds)) {
+      add_item(renderer, font, &bounds, GROUP_GLYPHS, command->glyph_color, NULL, i);
+    }
+  }
+
+  emit_groups(renderer, font);
+  command_count = 0;
+
+  if (font != NULL) {
+    SDL_SetTextureColorMod(font, mod_r, mod_g, mod_b);
+  }
+}
+
+void draw_batch_discard(void) { command_count = 0; }
+
+Uint64 draw_batch_draw_calls(void) { return total_draw_calls; }
+
+void draw_batch_log_stats(int frames) {
+  if (frames <= 0) {
+    return;
+  }
+  SDL_LogDebug(SDL_LOG_CATEGORY_RENDER,
+               "Draw batch: %.1f commands/frame, %.1f overwritten, %.1f draw calls/frame",
+               (float)stats.commands / frames, (float)stats.culled / frames,
+               (float)stats.draw_calls / frames);
+  stats.commands = 0;
+  stats.culled = 0;
+  stats.draw_calls = 0;
+}
@@ -0,0 +1,41 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#ifndef DRAW_BATCH_H_
+#define DRAW_BATCH_H_
+
+#include <SDL3/SDL.h>
+
+// Collects the rectangles and characters of a batch of M8 draw commands and submits them with as
+// few render calls as possible. Commands that are completely overwritten later in the same batch
+// are dropped, and the rest are grouped into SDL_RenderFillRects and SDL_RenderGeometry calls
+// without changing the result of overlapping draws.
+
+// Returns non-zero when nothing more can be queued before a flush
+int draw_batch_is_full(void);
+
+// Queue a filled rectangle
+void draw_batch_rect(const SDL_FRect *rect, SDL_Color color);
+
+// Queue a character: an optional opaque background rectangle (NULL for a transparent background)
+// and a glyph from the font texture given to draw_batch_flush(). A NULL glyph source queues only
+// the background.
+void draw_batch_character(const SDL_FRect *background, SDL_Color background_color,
+                          const SDL_FRect *glyph, const SDL_FRect *glyph_source,
+                          SDL_Color glyph_color);
+
+// Draw everything queued so far to the current render target. The font texture must be the one
+// the queued glyph sources refer to. Must be called before anything else draws to the target.
+void draw_batch_flush(SDL_Renderer *renderer, SDL_Texture *font, int target_width,
+                      int target_height);
+
+// Drop everything queued so far, e.g. when the render target is recreated
+void draw_batch_discard(void);
+
+// Total number of draw calls issued since startup
+Uint64 draw_batch_draw_calls(void);
+
+// Log commands received vs. draw calls issued, averaged over the given number of frames
+void draw_batch_log_stats(int frames);
+
+#endif
@@ -21,9 +21,17 @@ SDL_AppResult SDL_AppEvent(void *appstate, SDL_Event *event) {
     break;
   case SDL_EVENT_WINDOW_RESIZED:
   case SDL_EVENT_WINDOW_MOVED:
+  case SDL_EVENT_WINDOW_DISPLAY_CHANGED:
     // If the window size is changed, some systems might need a little nudge to fix scaling
     renderer_fix_texture_scaling_after_window_resize(&ctx->conf);
     break;
+  case SDL_EVENT_RENDER_DEVICE_RESET:
+    // Textures were lost with the device, ask the M8 to redraw everything once they are back
+    renderer_on_device_reset();
+    if (ctx->device_connected) {
+      m8_reset_display();
+    }
+    break;
 
   // --- iOS specific events ---
   case SDL_EVENT_DID_ENTER_BACKGROUND:
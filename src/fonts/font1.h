@@ -1,9 +1,9 @@
 #ifndef FONT1_H_
 #define FONT1_H_
 
-#include "fonts.h"
+#include "font_bmp.h"
 
-struct inline_font font_v1_small = {
+struct inline_font_bmp font_v1_small = {
     470,
     7,
     5,
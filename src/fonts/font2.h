@@ -1,9 +1,9 @@
 #ifndef FONT2_H_
 #define FONT2_H_
 
-#include "fonts.h"
+#include "font_bmp.h"
 
-struct inline_font font_v1_large = {
+struct inline_font_bmp font_v1_large = {
     752,
     9,
     8,
@@ -1,9 +1,9 @@
 #ifndef FONT3_H_
 #define FONT3_H_
 
-#include "fonts.h"
+#include "font_bmp.h"
 
-struct inline_font font_v2_small = {
+struct inline_font_bmp font_v2_small = {
     846,
     9,
     9,
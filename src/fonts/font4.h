@@ -1,9 +1,9 @@
 #ifndef FONT4_H_
 #define FONT4_H_
 
-#include "fonts.h"
+#include "font_bmp.h"
 
-struct inline_font font_v2_large = {
+struct inline_font_bmp font_v2_large = {
     940,
     10,
     10,
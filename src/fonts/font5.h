@@ -1,9 +1,9 @@
 #ifndef FONT5_H_
 #define FONT5_H_
 
-#include "fonts.h"
+#include "font_bmp.h"
 
-struct inline_font font_v2_huge = {
+struct inline_font_bmp font_v2_huge = {
     1128,
     12,
     12,
@@ -0,0 +1,21 @@
+// font_bmp.h
+#ifndef FONT_BMP_H
+#define FONT_BMP_H
+
+// Source form of the embedded fonts: metrics followed by a BMP image holding the glyphs of
+// '!'..'~' in a single row, white on black. Only read by bench/font_packer.c, which generates
+// font_data.h from these.
+struct inline_font_bmp {
+  const int width;
+  const int height;
+  const int glyph_x;
+  const int glyph_y;
+  const int screen_offset_x;
+  const int screen_offset_y;
+  const int text_offset_y;
+  const int waveform_max_height;
+  const long image_size;
+  const unsigned char image_data[];
+};
+
+#endif // FONT_BMP_H
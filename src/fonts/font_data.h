@@ -0,0 +1,497 @@
+// Generated by bench/font_packer.c from font1.h ... font5.h, do not edit.
+#ifndef FONT_DATA_H_
+#define FONT_DATA_H_
+
+#include "fonts.h"
+
+static const unsigned char font_v1_small_glyphs[658] = {
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x80, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xF8, 0x50, 0xF8, 0x50, 0x00, 0x20, 0xF8, 0xA0, 0xF8, 0x28, 0xF8, 0x20, 0x00, 0xC8, 0xD0, 0x20,
+    0x58, 0x98, 0x00, 0x60, 0x90, 0xA0, 0x48, 0xA8, 0x90, 0x68, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x00,
+    0x50, 0x20, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0xF8, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x08, 0x08, 0x10, 0x20, 0x40, 0x80, 0x80, 0xF8, 0x88, 0x98, 0xA8, 0xC8, 0x88, 0xF8,
+    0x20, 0xE0, 0x20, 0x20, 0x20, 0x20, 0xF8, 0xF8, 0x08, 0x08, 0xF8, 0x80, 0x80, 0xF8, 0xF8, 0x08,
+    0x08, 0xF8, 0x08, 0x08, 0xF8, 0x88, 0x88, 0x88, 0xF8, 0x08, 0x08, 0x08, 0xF8, 0x80, 0x80, 0xF8,
+    0x08, 0x08, 0xF8, 0xF8, 0x80, 0x80, 0xF8, 0x88, 0x88, 0xF8, 0xF8, 0x08, 0x08, 0x10, 0x20, 0x20,
+    0x20, 0x78, 0x88, 0x88, 0xF8, 0x88, 0x88, 0xF0, 0xF8, 0x88, 0x88, 0xF8, 0x08, 0x08, 0x08, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x10, 0x30,
+    0x70, 0x30, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x60, 0x70, 0x60,
+    0x40, 0x00, 0x70, 0x88, 0x08, 0x10, 0x20, 0x00, 0x20, 0x70, 0x88, 0xB8, 0xA8, 0xB8, 0x80, 0x70,
+    0x70, 0x88, 0x88, 0xF8, 0x88, 0x88, 0x88, 0xF0, 0x88, 0x88, 0xF0, 0x88, 0x88, 0xF0, 0x70, 0x88,
+    0x80, 0x80, 0x80, 0x88, 0x70, 0xF0, 0x88, 0x88, 0x88, 0x88, 0x88, 0xF0, 0xF8, 0x80, 0x80, 0xF0,
+    0x80, 0x80, 0xF8, 0xF8, 0x80, 0x80, 0xF0, 0x80, 0x80, 0x80, 0x70, 0x88, 0x80, 0x80, 0x98, 0x88,
+    0x70, 0x88, 0x88, 0x88, 0xF8, 0x88, 0x88, 0x88, 0xF8, 0x20, 0x20, 0x20, 0x20, 0x20, 0xF8, 0x08,
+    0x08, 0x08, 0x08, 0x88, 0x88, 0x70, 0x88, 0x90, 0xA0, 0xC0, 0xA0, 0x90, 0x88, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xF8, 0x88, 0xD8, 0xA8, 0x88, 0x88, 0x88, 0x88, 0x88, 0xC8, 0xA8, 0x98, 0x88,
+    0x88, 0x88, 0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0xF0, 0x88, 0x88, 0xF0, 0x80, 0x80, 0x80,
+    0x70, 0x88, 0x88, 0x88, 0xA8, 0x90, 0x68, 0xF0, 0x88, 0x88, 0xF0, 0x90, 0x88, 0x88, 0x78, 0x80,
+    0x80, 0x70, 0x08, 0x08, 0xF0, 0xF8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x70, 0x88, 0x88, 0x88, 0x88, 0x50, 0x50, 0x20, 0x88, 0x88, 0x88, 0x88, 0xA8, 0xD8,
+    0x88, 0x88, 0x88, 0x50, 0x20, 0x50, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x08, 0x08, 0xF0, 0xF8,
+    0x08, 0x10, 0x20, 0x40, 0x80, 0xF8, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x80, 0x80, 0x40,
+    0x20, 0x10, 0x08, 0x08, 0xC0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xC0, 0x20, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0x08, 0xF8, 0x88, 0xF8, 0x80, 0x80, 0xF8, 0x88, 0x88, 0x88, 0xF8, 0x00, 0x00,
+    0xF8, 0x80, 0x80, 0x80, 0xF8, 0x08, 0x08, 0xF8, 0x88, 0x88, 0x88, 0xF8, 0x00, 0x00, 0xF8, 0x88,
+    0xF8, 0x80, 0xF8, 0x38, 0x20, 0xF8, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0xF8, 0x88, 0xF8, 0x08,
+    0xF8, 0x80, 0x80, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x20, 0x00, 0x60, 0x20, 0x20, 0x20, 0x70, 0x10,
+    0x00, 0x10, 0x10, 0x10, 0x10, 0xE0, 0x80, 0x80, 0x88, 0x90, 0xA0, 0xD0, 0x88, 0x60, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0xF8, 0xA8, 0xA8, 0xA8, 0xA8, 0x00, 0x00, 0xF8, 0x88, 0x88,
+    0x88, 0x88, 0x00, 0x00, 0xF8, 0x88, 0x88, 0x88, 0xF8, 0x00, 0x00, 0xF8, 0x88, 0x88, 0xF8, 0x80,
+    0x00, 0x00, 0xF8, 0x88, 0x88, 0xF8, 0x08, 0x00, 0x00, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0xF8, 0x80, 0xF8, 0x08, 0xF8, 0x20, 0x20, 0xF8, 0x20, 0x20, 0x20, 0x38, 0x00, 0x00, 0x88, 0x88,
+    0x88, 0x88, 0xF8, 0x00, 0x00, 0x88, 0x88, 0x90, 0xA0, 0xC0, 0x00, 0x00, 0xA8, 0xA8, 0xA8, 0xA8,
+    0xF8, 0x00, 0x00, 0x88, 0x50, 0x20, 0x50, 0x88, 0x00, 0x00, 0x88, 0x88, 0xF8, 0x08, 0xF8, 0x00,
+    0x00, 0xF8, 0x10, 0x20, 0x40, 0xF8, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x88, 0xF8, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0xF8, 0x88, 0x88, 0xA8, 0x88, 0x88, 0xF8, 0x00, 0x48, 0xB0, 0x00, 0x00,
+    0x00, 0x00,
+};
+
+static const struct inline_font font_v1_small = {
+    470, 7, 5, 7, 0, 0, 3, 24, 5, 1, font_v1_small_glyphs};
+
+static const unsigned char font_v1_large_glyphs[846] = {
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x30, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x7E, 0x24, 0x24, 0x7E, 0x24, 0x00, 0x18, 0xFF, 0xD8, 0xD8, 0xFF,
+    0x1B, 0x1B, 0xFF, 0x18, 0x41, 0xE3, 0x46, 0x0C, 0x18, 0x30, 0x62, 0xC7, 0x82, 0x00, 0x38, 0x6C,
+    0x6C, 0x38, 0x78, 0xCF, 0xC6, 0x7B, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0x03, 0x60, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30,
+    0x60, 0xCC, 0x78, 0x30, 0x78, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7E, 0x18,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03,
+    0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x00, 0xFF, 0xC3, 0xC3, 0xC3, 0xDB, 0xC3, 0xC3, 0xC3, 0xFF,
+    0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0xFF, 0xC0, 0xC0,
+    0xC0, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x7F, 0x03, 0x03, 0x03, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF,
+    0x03, 0x03, 0x03, 0x03, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xC0, 0xC0,
+    0xC0, 0xFF, 0xC3, 0xC3, 0xC3, 0xFF, 0xFF, 0x03, 0x03, 0x06, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x3F,
+    0x63, 0xC3, 0xC3, 0x7E, 0xC3, 0xC3, 0xC3, 0xFE, 0xFF, 0xC3, 0xC3, 0xC3, 0xFF, 0x03, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
+    0x60, 0x60, 0xC0, 0x00, 0x03, 0x07, 0x0F, 0x1F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x7E, 0x00,
+    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x60, 0x70, 0x78, 0x7C, 0x78, 0x70, 0x60, 0x00, 0x7E, 0xC3,
+    0x03, 0x03, 0x1E, 0x18, 0x18, 0x00, 0x18, 0x7E, 0xC3, 0xC3, 0xDF, 0xDB, 0xDB, 0xDE, 0xC0, 0x7E,
+    0x3C, 0x66, 0xC3, 0xC3, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xFC, 0xC6, 0xC6, 0xC4, 0xFE, 0xC3, 0xC3,
+    0xC3, 0xFE, 0x7E, 0xC3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0x7E, 0xFC, 0xC6, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC6, 0xFC, 0xFF, 0xC0, 0xC0, 0xC0, 0xFC, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0,
+    0xC0, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0x7E, 0xC3, 0xC0, 0xC0, 0xCF, 0xC3, 0xC3, 0xC3, 0x7E, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0xC3, 0xC3, 0x7E, 0xC3, 0xC6, 0xCC, 0xD8, 0xF0, 0xD8,
+    0xCC, 0xC6, 0xC3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC3, 0xE7, 0xFF, 0xDB,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE3, 0xF3, 0xDB, 0xCF, 0xC7, 0xC3, 0xC3, 0xC3, 0x7E, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x7E, 0xFE, 0xC3, 0xC3, 0xC3, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0,
+    0x7E, 0xC3, 0xC3, 0xC3, 0xC3, 0xDB, 0xCD, 0xC6, 0x7B, 0xFE, 0xC3, 0xC3, 0xC3, 0xFE, 0xD8, 0xCC,
+    0xC6, 0xC3, 0x7E, 0xC3, 0xC0, 0xC0, 0x7E, 0x03, 0x03, 0xC3, 0x7E, 0xFF, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x7E, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0x66, 0x3C, 0x18, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xDB, 0xFF, 0xE7, 0xC3, 0xC3,
+    0xC3, 0x66, 0x3C, 0x18, 0x3C, 0x66, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x7E, 0x18, 0x18, 0x18,
+    0x18, 0xFF, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xFF, 0x0F, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0F, 0x00, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x00, 0xF0, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0xF0, 0x20, 0x70, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x03, 0x03, 0xFF, 0xC3, 0xC3, 0xFF, 0xC0, 0xC0, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x03, 0x03, 0xFF, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0xC3, 0xC3, 0xFF, 0xC0, 0xC0, 0xFF, 0x7F, 0x60, 0x60,
+    0xFF, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0xFF, 0xC3, 0xC3, 0xFF, 0x03, 0x03, 0xFF, 0xC0,
+    0xC0, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x18, 0x00, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0xFF, 0x03, 0x00, 0x7F, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xC0, 0xC0, 0xC3, 0xC6, 0xCC, 0xF8,
+    0xCC, 0xC6, 0xC3, 0xF0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xFF, 0x00, 0x00, 0xFF, 0xDB,
+    0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0x00, 0x00, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x00, 0x00,
+    0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0xC3, 0xC3, 0xFF, 0xC0, 0xC0, 0xC0,
+    0x00, 0x00, 0xFF, 0xC3, 0xC3, 0xFF, 0x03, 0x03, 0x03, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xFF, 0x03, 0x03, 0xFF, 0x60, 0x60, 0xFF, 0x60, 0x60,
+    0x60, 0x60, 0x60, 0x7F, 0x00, 0x00, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0x00, 0x00, 0xC3,
+    0xC6, 0xCC, 0xD8, 0xF0, 0xE0, 0xC0, 0x00, 0x00, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xFF, 0x00,
+    0x00, 0xC3, 0x66, 0x3C, 0x18, 0x3C, 0x66, 0xC3, 0x00, 0x00, 0xC3, 0xC3, 0xC3, 0xFF, 0x03, 0x03,
+    0xFF, 0x00, 0x00, 0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x76, 0xDC, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const struct inline_font font_v1_large = {
+    752, 9, 8, 9, 0, -40, 4, 22, 8, 1, font_v1_large_glyphs};
+
+static const unsigned char font_v2_small_glyphs[1692] = {
+    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x90, 0x00, 0x90, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0xFF, 0x80, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00,
+    0xFF, 0x80, 0x22, 0x00, 0x22, 0x00, 0x08, 0x00, 0xFF, 0x80, 0x88, 0x00, 0x88, 0x00, 0xFF, 0x80,
+    0x08, 0x80, 0x08, 0x80, 0xFF, 0x80, 0x08, 0x00, 0xE0, 0x80, 0xA1, 0x00, 0xE2, 0x00, 0x04, 0x00,
+    0x08, 0x00, 0x10, 0x00, 0x23, 0x80, 0x42, 0x80, 0x83, 0x80, 0x30, 0x00, 0x48, 0x00, 0x48, 0x00,
+    0x30, 0x00, 0x48, 0x80, 0x85, 0x00, 0x82, 0x00, 0x85, 0x00, 0x78, 0x80, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x80,
+    0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x40, 0x00,
+    0x80, 0x00, 0x44, 0x00, 0x28, 0x00, 0x10, 0x00, 0x28, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x7F, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x01, 0x00,
+    0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x00, 0xFF, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80,
+    0xF8, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
+    0xFF, 0x80, 0xFF, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xFF, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0xFF, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xFF, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80,
+    0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x3E, 0x00,
+    0x1E, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1C, 0x00,
+    0x1E, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x80, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x0F, 0x80, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0xFF, 0x80,
+    0x80, 0x80, 0xBE, 0x80, 0x82, 0x80, 0xBE, 0x80, 0xA2, 0x80, 0xBF, 0x80, 0x80, 0x00, 0xFF, 0x80,
+    0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0xFF, 0x80, 0xFE, 0x00, 0x81, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x81, 0x00, 0xFE, 0x00, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0xFF, 0x80, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xFF, 0x80, 0x80, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x80, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
+    0xFF, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x81, 0x00, 0x82, 0x00, 0x84, 0x00, 0xF8, 0x00, 0x84, 0x00,
+    0x82, 0x00, 0x81, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xFF, 0x80, 0x80, 0x80, 0xC1, 0x80, 0xA2, 0x80, 0x94, 0x80,
+    0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0x80, 0xA0, 0x80,
+    0x90, 0x80, 0x88, 0x80, 0x84, 0x80, 0x82, 0x80, 0x81, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x84, 0x80, 0x82, 0x80, 0x81, 0x00,
+    0xFE, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x84, 0x00, 0x82, 0x00,
+    0x81, 0x00, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x41, 0x00, 0x22, 0x00, 0x14, 0x00, 0x08, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x88, 0x80, 0x94, 0x80, 0xA2, 0x80, 0xC1, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x41, 0x00, 0x22, 0x00, 0x14, 0x00, 0x08, 0x00, 0x14, 0x00, 0x22, 0x00, 0x41, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0xFF, 0x80, 0xFF, 0x80, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00,
+    0x40, 0x00, 0xFF, 0x80, 0x0E, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x00, 0x0E, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x10, 0x00, 0x08, 0x00,
+    0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x80, 0x1C, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x1C, 0x00, 0x20, 0x00, 0x50, 0x00, 0x88, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x40, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x80, 0x00, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x80, 0x80, 0x00, 0x80, 0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x80, 0x00, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+    0x80, 0x00, 0x80, 0x00, 0xFE, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x00, 0x80, 0x00, 0x80, 0xFF, 0x80, 0x80, 0x00,
+    0x80, 0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x81, 0x00, 0x82, 0x00, 0xFC, 0x00,
+    0x82, 0x00, 0x81, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x88, 0x80,
+    0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00, 0xFF, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
+    0x81, 0x00, 0x82, 0x00, 0x84, 0x00, 0x88, 0x00, 0x90, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x80, 0x41, 0x00, 0x22, 0x00, 0x1C, 0x00, 0x22, 0x00, 0x41, 0x00, 0x80, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x80, 0x03, 0x00, 0x1C, 0x00, 0x60, 0x00,
+    0x80, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x64, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const struct inline_font font_v2_small = {
+    846, 9, 9, 9, 0, -2, 5, 38, 9, 2, font_v2_small_glyphs};
+
+static const unsigned char font_v2_large_glyphs[1880] = {
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00,
+    0xC0, 0x00, 0xC0, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x33, 0x00, 0xFF, 0xC0, 0xFF, 0xC0,
+    0x33, 0x00, 0x33, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x33, 0x00, 0x33, 0x00, 0x0C, 0x00, 0x7F, 0xC0,
+    0xFF, 0xC0, 0xCC, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x0C, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0x0C, 0x00,
+    0x60, 0xC0, 0x61, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00,
+    0xE1, 0x80, 0xC1, 0x80, 0x3C, 0x00, 0x7E, 0x00, 0x66, 0x00, 0x66, 0x00, 0x7C, 0xC0, 0xFF, 0xC0,
+    0xC7, 0x80, 0xC7, 0x80, 0xFF, 0xC0, 0x7C, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x03, 0x80,
+    0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0x80,
+    0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00,
+    0xE0, 0x00, 0xC0, 0x00, 0xC6, 0x00, 0xEE, 0x00, 0x38, 0x00, 0x38, 0x00, 0xEE, 0x00, 0xC6, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+    0x7F, 0x80, 0x7F, 0x80, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00,
+    0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0,
+    0xFC, 0x00, 0xFC, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0,
+    0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
+    0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
+    0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x0E, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x1E, 0x00,
+    0x1C, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0xC0,
+    0x0F, 0xC0, 0x0F, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x7F, 0x80, 0xFF, 0xC0,
+    0xC0, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCF, 0xC0, 0xCF, 0xC0, 0xC0, 0x00, 0xFF, 0x00, 0x7F, 0x00,
+    0x7F, 0x80, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x00, 0xFF, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xFF, 0x00, 0xFF, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0x7F, 0xC0, 0xFF, 0xC0, 0xC0, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0xFF, 0x00, 0xFF, 0x80,
+    0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xFF, 0x80,
+    0x7F, 0xC0, 0xFF, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xC0, 0x00, 0xC0, 0x00,
+    0xFF, 0xC0, 0x7F, 0xC0, 0x7F, 0xC0, 0xFF, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0,
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0xC0, 0x00, 0xC0, 0x00,
+    0xCF, 0xC0, 0xCF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x7F, 0x80, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+    0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
+    0x00, 0xC0, 0x00, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0xC0, 0xC0, 0xC1, 0xC0, 0xC3, 0x80, 0xC7, 0x00,
+    0xFE, 0x00, 0xFE, 0x00, 0xC7, 0x00, 0xC3, 0x80, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x7F, 0xC0,
+    0xC0, 0xC0, 0xE1, 0xC0, 0xF3, 0xC0, 0xFF, 0xC0, 0xDE, 0xC0, 0xCC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xC0, 0xF0, 0xC0, 0xF8, 0xC0, 0xDC, 0xC0, 0xCE, 0xC0,
+    0xC7, 0xC0, 0xC3, 0xC0, 0xC1, 0xC0, 0xC0, 0xC0, 0x7F, 0x80, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x7F, 0x80, 0xFF, 0x80, 0xFF, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0x7F, 0x80, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xCC, 0xC0, 0xCE, 0xC0, 0xC7, 0xC0, 0xC3, 0xC0,
+    0xF9, 0xC0, 0x7C, 0xC0, 0xFF, 0x80, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xFF, 0x80,
+    0xC7, 0x00, 0xC3, 0x80, 0xC1, 0xC0, 0xC0, 0xC0, 0x7F, 0xC0, 0xFF, 0xC0, 0xC0, 0x00, 0xC0, 0x00,
+    0xFF, 0x80, 0x7F, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xC0,
+    0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xFF, 0xC0, 0x7F, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE1, 0xC0,
+    0x73, 0x80, 0x3F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xCC, 0xC0, 0xDE, 0xC0, 0xFF, 0xC0, 0xF3, 0xC0, 0xE1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE1, 0xC0,
+    0x73, 0x80, 0x3F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3F, 0x00, 0x73, 0x80, 0xE1, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
+    0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00,
+    0x38, 0x00, 0x70, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x0F, 0x00, 0x0F, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+    0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0xC0, 0x00, 0xE0, 0x00,
+    0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xC0,
+    0x1E, 0x00, 0x1E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x3C, 0x00, 0x7E, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x60, 0x00, 0x70, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0,
+    0xFF, 0xC0, 0x7F, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0,
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
+    0x7F, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xC0, 0x00,
+    0xFF, 0xC0, 0x7F, 0xC0, 0x1F, 0xC0, 0x3F, 0xC0, 0x30, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0,
+    0xC0, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0xC0, 0x00, 0xC0, 0x00,
+    0xFF, 0x80, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0x0C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+    0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
+    0x00, 0xC0, 0x00, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0xC0, 0x00, 0xC0, 0x00, 0xC3, 0x80, 0xC7, 0x00,
+    0xCE, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xC7, 0x00, 0xC3, 0x80, 0xC1, 0xC0, 0x3C, 0x00, 0x3C, 0x00,
+    0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0xFF, 0xC0, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0,
+    0xCC, 0xC0, 0xCC, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0xC0, 0x00, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0,
+    0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0xC0, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0,
+    0xC0, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0x30, 0x00, 0x30, 0x00,
+    0xFF, 0xC0, 0xFF, 0xC0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xC0, 0x1F, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xFF, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC1, 0xC0, 0xC3, 0x80, 0xC7, 0x00,
+    0xCE, 0x00, 0xDC, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xC0, 0xCC, 0xC0,
+    0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xC0, 0xE1, 0xC0, 0x73, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x73, 0x80, 0xE1, 0xC0, 0xC0, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0xC0,
+    0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x03, 0xC0, 0x1F, 0x80,
+    0x7E, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xC0, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0xFE, 0x00, 0xDC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const struct inline_font font_v2_large = {
+    940, 10, 10, 10, 0, -2, 4, 38, 10, 2, font_v2_large_glyphs};
+
+static const unsigned char font_v2_huge_glyphs[2256] = {
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xCC, 0x00, 0xCC, 0x00, 0xCC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x80, 0x19, 0x80, 0x7F, 0xE0, 0x7F, 0xE0, 0x19, 0x80, 0x19, 0x80, 0x7F, 0xE0,
+    0x7F, 0xE0, 0x19, 0x80, 0x19, 0x80, 0x00, 0x00, 0x06, 0x00, 0x7F, 0xF0, 0xFF, 0xF0, 0xC6, 0x00,
+    0xC6, 0x00, 0xFF, 0xE0, 0x7F, 0xF0, 0x06, 0x30, 0x06, 0x30, 0xFF, 0xF0, 0xFF, 0xE0, 0x06, 0x00,
+    0x00, 0x00, 0x70, 0x60, 0x70, 0xE0, 0x71, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00,
+    0x38, 0xE0, 0x70, 0xE0, 0x60, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x3F, 0x80, 0x31, 0x80, 0x31, 0x80,
+    0x1F, 0x00, 0x7E, 0x30, 0xE7, 0x70, 0xC3, 0xE0, 0xC1, 0xC0, 0xE3, 0xE0, 0x7F, 0x70, 0x3E, 0x30,
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xC0,
+    0x18, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x18, 0x00, 0xC6, 0x00, 0xEE, 0x00, 0x7C, 0x00, 0x7C, 0x00,
+    0xEE, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00,
+    0x00, 0x30, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00,
+    0x38, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30,
+    0xC0, 0x30, 0xC6, 0x30, 0xC6, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0,
+    0xFE, 0x00, 0xFE, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x30, 0x00, 0x30,
+    0x00, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0,
+    0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x30,
+    0x00, 0x30, 0x00, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30,
+    0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30,
+    0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x30,
+    0x00, 0x30, 0x00, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0,
+    0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30,
+    0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30,
+    0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0,
+    0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x30,
+    0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x70, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00,
+    0x0F, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
+    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0E, 0x00,
+    0x0F, 0x00, 0x0F, 0x80, 0x0F, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xE0, 0xFF, 0xF0, 0xC0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x03, 0xF0, 0x07, 0xE0, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x7F, 0xE0, 0xFF, 0xF0, 0xC6, 0x30, 0xC6, 0x30,
+    0xC6, 0x30, 0xC6, 0x30, 0xC7, 0xF0, 0xC7, 0xF0, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x7F, 0xC0,
+    0x7F, 0xE0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x30,
+    0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xC0, 0xFF, 0xE0, 0xC0, 0x60, 0xC0, 0x60,
+    0xC0, 0x60, 0xFF, 0xC0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xE0,
+    0x7F, 0xF0, 0xFF, 0xF0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xF0, 0x7F, 0xF0, 0xFF, 0xC0, 0xFF, 0xE0, 0xC0, 0x70, 0xC0, 0x30,
+    0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xE0,
+    0x7F, 0xF0, 0xFF, 0xF0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x00,
+    0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0xFF, 0xF0, 0xC0, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0x7F, 0xF0, 0xFF, 0xF0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xCF, 0xF0, 0xCF, 0xF0, 0xC0, 0x30,
+    0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0x7F, 0xE0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30,
+    0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30,
+    0xFF, 0xF0, 0xFF, 0xF0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30,
+    0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0xFF, 0xF0, 0xFF, 0xE0,
+    0xC0, 0x30, 0xC0, 0x70, 0xC0, 0xE0, 0xC1, 0xC0, 0xC3, 0x80, 0xFF, 0x00, 0xFF, 0x00, 0xC3, 0x80,
+    0xC1, 0xC0, 0xC0, 0xE0, 0xC0, 0x70, 0xC0, 0x30, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xF0, 0x7F, 0xF0,
+    0xC0, 0x30, 0xE0, 0x70, 0xF0, 0xF0, 0xF9, 0xF0, 0xDF, 0xB0, 0xCF, 0x30, 0xC6, 0x30, 0xC0, 0x30,
+    0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xE0, 0x30, 0xF0, 0x30, 0xF8, 0x30,
+    0xDC, 0x30, 0xCE, 0x30, 0xC7, 0x30, 0xC3, 0xB0, 0xC1, 0xF0, 0xC0, 0xF0, 0xC0, 0x70, 0xC0, 0x30,
+    0x7F, 0xE0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30,
+    0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0x7F, 0xE0, 0xFF, 0xE0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30,
+    0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xE0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0x7F, 0xE0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC3, 0x30, 0xC3, 0xB0,
+    0xC1, 0xF0, 0xC0, 0xF0, 0xFE, 0x70, 0x7F, 0x30, 0xFF, 0xE0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30,
+    0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xE0, 0xC3, 0x80, 0xC1, 0xC0, 0xC0, 0xE0, 0xC0, 0x70, 0xC0, 0x30,
+    0x7F, 0xF0, 0xFF, 0xF0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0x30,
+    0x00, 0x30, 0x00, 0x30, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0xF0, 0xFF, 0xF0, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30,
+    0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0x7F, 0xE0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30,
+    0xC0, 0x30, 0xC0, 0x30, 0xE0, 0x70, 0x70, 0xE0, 0x39, 0xC0, 0x1F, 0x80, 0x0F, 0x00, 0x06, 0x00,
+    0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC6, 0x30, 0xCF, 0x30, 0xDF, 0xB0,
+    0xF9, 0xF0, 0xF0, 0xF0, 0xE0, 0x70, 0xC0, 0x30, 0xC0, 0x30, 0xE0, 0x70, 0x70, 0xE0, 0x39, 0xC0,
+    0x1F, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x39, 0xC0, 0x70, 0xE0, 0xE0, 0x70, 0xC0, 0x30,
+    0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0x7F, 0xF0, 0x00, 0x30,
+    0x00, 0x30, 0x00, 0x30, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0xE0, 0x01, 0xC0,
+    0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xFF, 0xF0, 0xFF, 0xF0,
+    0x3F, 0x00, 0x3F, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00,
+    0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x30,
+    0x1F, 0x80, 0x1F, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+    0x01, 0x80, 0x01, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x06, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x39, 0xC0,
+    0x70, 0xE0, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x60, 0x00, 0x70, 0x00, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x30, 0x00, 0x30, 0xFF, 0xF0, 0xFF, 0xF0,
+    0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0x7F, 0xF0, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xE0, 0xFF, 0xF0,
+    0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xF0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xF0, 0x7F, 0xF0, 0x00, 0x30, 0x00, 0x30, 0x7F, 0xF0, 0xFF, 0xF0,
+    0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0x7F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0,
+    0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xF0, 0x7F, 0xF0, 0x1F, 0xF0, 0x3F, 0xF0, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0x7F, 0xF0,
+    0x00, 0x30, 0x00, 0x30, 0xFF, 0xF0, 0xFF, 0xE0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xE0,
+    0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30,
+    0x06, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0xFF, 0xF0, 0xFF, 0xE0,
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0xE0, 0xC1, 0xC0, 0xC3, 0x80, 0xC7, 0x00, 0xFE, 0x00, 0xFF, 0x00,
+    0xC3, 0x80, 0xC1, 0xC0, 0xC0, 0xE0, 0xC0, 0x70, 0x1E, 0x00, 0x1E, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0xFF, 0xF0, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xF0, 0xC6, 0x30, 0xC6, 0x30, 0xC6, 0x30, 0xC6, 0x30,
+    0xC6, 0x30, 0xC6, 0x30, 0xC6, 0x30, 0xC6, 0x30, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xF0,
+    0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30,
+    0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xF0,
+    0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xE0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0,
+    0x7F, 0xF0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xF0,
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xF0, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xE0, 0x7F, 0xF0,
+    0x00, 0x30, 0x00, 0x30, 0xFF, 0xF0, 0xFF, 0xE0, 0x30, 0x00, 0x30, 0x00, 0xFF, 0xF0, 0xFF, 0xF0,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xF0, 0x1F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30,
+    0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x30, 0xC0, 0x70,
+    0xC0, 0xE0, 0xC1, 0xC0, 0xC3, 0x80, 0xC7, 0x00, 0xCE, 0x00, 0xDC, 0x00, 0xF8, 0x00, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC6, 0x30, 0xC6, 0x30, 0xC6, 0x30, 0xC6, 0x30, 0xC6, 0x30, 0xC6, 0x30,
+    0xC6, 0x30, 0xC6, 0x30, 0xFF, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x30, 0xE0, 0x70,
+    0x70, 0xE0, 0x39, 0xC0, 0x1F, 0x80, 0x1F, 0x80, 0x39, 0xC0, 0x70, 0xE0, 0xE0, 0x70, 0xC0, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0x7F, 0xF0,
+    0x00, 0x30, 0x00, 0x30, 0xFF, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0,
+    0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0xFF, 0xF0, 0xFF, 0xF0,
+    0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30,
+    0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0xFF, 0xF0, 0xFF, 0xF0, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30,
+    0xC0, 0x30, 0xC0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x76, 0x00, 0xFE, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const struct inline_font font_v2_huge = {
+    1128, 12, 12, 12, 0, -54, 4, 24, 12, 2, font_v2_huge_glyphs};
+
+#endif // FONT_DATA_H_
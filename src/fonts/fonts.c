@@ -1,14 +1,10 @@
 // fonts.c
 #include "fonts.h"
-#include "font1.h"
-#include "font2.h"
-#include "font3.h"
-#include "font4.h"
-#include "font5.h"
+#include "font_data.h"
 
 #include <stddef.h>
 
-static struct inline_font *fonts_storage[] = {
+static const struct inline_font *const fonts_storage[] = {
   &font_v1_small, &font_v1_large, &font_v2_small, &font_v2_large, &font_v2_huge
 };
 
@@ -19,11 +15,23 @@ size_t fonts_count(void) {
 }
 
 const struct inline_font *fonts_get(const size_t index) {
-  return (index < FONT_COUNT) ? (const struct inline_font *)fonts_storage[index] : NULL;
+  return (index < FONT_COUNT) ? fonts_storage[index] : NULL;
 }
 
 const struct inline_font *const *fonts_all(size_t *count) {
   if (count) *count = FONT_COUNT;
-  // Cast to a read-only view so callers can’t mutate the array or elements
-  return (const struct inline_font *const *)fonts_storage;
-}
\ No newline at end of file
+  return fonts_storage;
+}
+
+void fonts_unpack(const struct inline_font *font, uint32_t *pixels, const uint32_t set,
+                  const uint32_t clear) {
+  for (int glyph = 0; glyph < FONTS_GLYPH_COUNT; glyph++) {
+    const unsigned char *rows = font->glyphs + glyph * font->height * font->row_bytes;
+    for (int y = 0; y < font->height; y++, rows += font->row_bytes) {
+      uint32_t *dst = pixels + y * font->width + glyph * font->glyph_width;
+      for (int x = 0; x < font->glyph_width; x++) {
+        dst[x] = rows[x >> 3] & (0x80 >> (x & 7)) ? set : clear;
+      }
+    }
+  }
+}
@@ -3,9 +3,14 @@
 #define FONTS_H
 
 #include <stddef.h>
+#include <stdint.h>
+
+// Every font has the glyphs of '!'..'~', laid out in a single row like the original bitmaps
+#define FONTS_GLYPH_COUNT 94
+#define FONTS_FIRST_CHARACTER '!'
 
 struct inline_font {
-  const int width;
+  const int width; // Width of the glyph row, FONTS_GLYPH_COUNT * glyph_width
   const int height;
   const int glyph_x;
   const int glyph_y;
@@ -13,8 +18,11 @@ struct inline_font {
   const int screen_offset_y;
   const int text_offset_y;
   const int waveform_max_height;
-  const long image_size;
-  const unsigned char image_data[];
+  const int glyph_width; // Width of a glyph cell
+  const int row_bytes;   // Bytes per glyph row in glyphs
+  // 1-bpp glyphs generated by bench/font_packer.c: height rows of row_bytes per glyph, most
+  // significant bit first. Set bits are white, clear bits transparent.
+  const unsigned char *glyphs;
 };
 
 // Number of available fonts
@@ -26,4 +34,16 @@ const struct inline_font *fonts_get(size_t index);
 // Get the whole font table (read-only). If count != NULL, it receives the length.
 const struct inline_font *const *fonts_all(size_t *count);
 
-#endif // FONTS_H
\ No newline at end of file
+// Expand a font into a width x height image, one 32-bit pixel per texel
+void fonts_unpack(const struct inline_font *font, uint32_t *pixels, uint32_t set,
+                  uint32_t clear);
+
+// Non-zero if the texel at x, y of the font image is set
+static inline int fonts_texel(const struct inline_font *font, int x, int y) {
+  const int glyph = x / font->glyph_width;
+  const int column = x - glyph * font->glyph_width;
+  const unsigned char *row = font->glyphs + (glyph * font->height + y) * font->row_bytes;
+  return row[column >> 3] & (0x80 >> (column & 7));
+}
+
+#endif // FONTS_H
@@ -0,0 +1,153 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#include "frame_pacing.h"
+
+#include <SDL3/SDL.h>
+
+// How close to the estimated vblank a frame is presented in vsync mode. Presenting blocks until
+// the vblank, so everything received before this point still makes it to the screen.
+#define PRESENT_MARGIN_NS (3 * SDL_NS_PER_MS)
+// Re-synchronize to the real vblank after this many refreshes without presenting
+#define MAX_ESTIMATED_REFRESHES 8
+
+#define HISTOGRAM_BUCKETS 64 // 1 ms each, the last one also holds everything slower
+
+typedef struct {
+  Uint32 buckets[HISTOGRAM_BUCKETS];
+  Uint32 count;
+  Uint64 max_ns;
+} latency_histogram_s;
+
+static const char *mode_names[] = {"vsync", "low_latency", "power_saving"};
+
+static enum frame_pacing_mode mode = FRAME_PACING_VSYNC;
+static Uint64 refresh_interval_ns = 0;
+static Uint64 power_saving_interval_ns = 0;
+static Uint64 last_present_ns = 0;
+
+static Uint64 input_ns = 0; // Oldest input whose response has not been presented yet
+static int input_answered = 0;
+static Uint64 first_change_ns = 0; // First screen change since the previous present
+
+static latency_histogram_s input_to_photon;
+static latency_histogram_s packet_to_present;
+
+enum frame_pacing_mode frame_pacing_mode_from_name(const char *name) {
+  for (int i = 0; i < (int)SDL_arraysize(mode_names); i++) {
+    if (name != NULL && SDL_strcasecmp(name, mode_names[i]) == 0) {
+      return (enum frame_pacing_mode)i;
+    }
+  }
+  return FRAME_PACING_VSYNC;
+}
+
+const char *frame_pacing_mode_name(enum frame_pacing_mode pacing_mode) {
+  if ((unsigned int)pacing_mode >= SDL_arraysize(mode_names)) {
+    return mode_names[FRAME_PACING_VSYNC];
+  }
+  return mode_names[pacing_mode];
+}
+
+void frame_pacing_initialize(const config_params_s *conf) {
+  mode = conf->frame_pacing;
+  power_saving_interval_ns = SDL_NS_PER_SECOND / SDL_clamp(conf->power_saving_fps, 1, 120);
+
+  // Input and device data are drained on every iteration, so the loop stays fast in all modes.
+  // 500 Hz is often enough to hit the window before each vblank.
+  const char *rate = mode == FRAME_PACING_LOW_LATENCY ? "1000" : "500";
+  SDL_SetHint(SDL_HINT_MAIN_CALLBACK_RATE, rate);
+  SDL_LogDebug(SDL_LOG_CATEGORY_RENDER, "Frame pacing: %s, main loop at %s Hz",
+               frame_pacing_mode_name(mode), rate);
+}
+
+int frame_pacing_uses_vsync(void) { return mode != FRAME_PACING_LOW_LATENCY; }
+
+void frame_pacing_set_refresh_rate(float refresh_rate) {
+  refresh_interval_ns = refresh_rate > 0 ? (Uint64)(SDL_NS_PER_SECOND / refresh_rate) : 0;
+}
+
+int frame_pacing_should_present(void) {
+  if (mode == FRAME_PACING_LOW_LATENCY || last_present_ns == 0) {
+    return 1;
+  }
+
+  const Uint64 elapsed = SDL_GetTicksNS() - last_present_ns;
+  if (mode == FRAME_PACING_POWER_SAVING) {
+    return elapsed >= power_saving_interval_ns;
+  }
+  if (refresh_interval_ns == 0) {
+    return 1;
+  }
+  if (elapsed >= MAX_ESTIMATED_REFRESHES * refresh_interval_ns) {
+    return 1;
+  }
+  return refresh_interval_ns - elapsed % refresh_interval_ns <= PRESENT_MARGIN_NS;
+}
+
+void frame_pacing_input_sent(void) {
+  if (input_ns == 0) {
+    input_ns = SDL_GetTicksNS();
+    input_answered = 0;
+  }
+}
+
+void frame_pacing_screen_changed(void) {
+  if (first_change_ns == 0) {
+    first_change_ns = SDL_GetTicksNS();
+  }
+  if (input_ns != 0) {
+    input_answered = 1;
+  }
+}
+
+static void add_sample(latency_histogram_s *histogram, Uint64 latency_ns) {
+  const Uint64 bucket = latency_ns / SDL_NS_PER_MS;
+  histogram->buckets[bucket < HISTOGRAM_BUCKETS ? bucket : HISTOGRAM_BUCKETS - 1]++;
+  histogram->count++;
+  histogram->max_ns = SDL_max(histogram->max_ns, latency_ns);
+}
+
+void frame_pacing_presented(void) {
+  const Uint64 now = SDL_GetTicksNS();
+  last_present_ns = now;
+
+  if (first_change_ns != 0) {
+    add_sample(&packet_to_present, now - first_change_ns);
+    first_change_ns = 0;
+  }
+  if (input_ns != 0 && input_answered) {
+    add_sample(&input_to_photon, now - input_ns);
+    input_ns = 0;
+    input_answered = 0;
+  }
+}
+
+// Upper bound of the bucket holding the given fraction of samples, in milliseconds
+static int histogram_percentile(const latency_histogram_s *histogram, float fraction) {
+  const Uint32 target = (Uint32)SDL_ceilf((float)histogram->count * fraction);
+  Uint32 seen = 0;
+  for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+    seen += histogram->buckets[i];
+    if (seen >= target) {
+      return i + 1;
+    }
+  }
+  return HISTOGRAM_BUCKETS;
+}
+
+static void log_histogram(const char *name, latency_histogram_s *histogram) {
+  if (histogram->count > 0) {
+    SDL_LogDebug(SDL_LOG_CATEGORY_RENDER,
+                 "%s latency: %u samples, p50 <%d ms, p90 <%d ms, p99 <%d ms, max %.1f ms", name,
+                 histogram->count, histogram_percentile(histogram, 0.5f),
+                 histogram_percentile(histogram, 0.9f), histogram_percentile(histogram, 0.99f),
+                 (double)histogram->max_ns / SDL_NS_PER_MS);
+  }
+  SDL_zerop(histogram);
+}
+
+void frame_pacing_log_stats(void) {
+  log_histogram("Input-to-photon", &input_to_photon);
+  log_histogram("Packet-to-present", &packet_to_present);
+}
@@ -0,0 +1,41 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#ifndef FRAME_PACING_H_
+#define FRAME_PACING_H_
+
+#include "config.h"
+
+// Decides when a changed screen is presented. Device data and input are processed on every
+// main loop iteration regardless of the mode.
+enum frame_pacing_mode {
+  FRAME_PACING_VSYNC,        // Present right before the next vblank
+  FRAME_PACING_LOW_LATENCY,  // Present as soon as the screen changes, without vsync
+  FRAME_PACING_POWER_SAVING, // Present at most power_saving_fps times per second
+};
+
+// Parse/format the config file names of the modes. Unknown names parse as FRAME_PACING_VSYNC.
+enum frame_pacing_mode frame_pacing_mode_from_name(const char *name);
+const char *frame_pacing_mode_name(enum frame_pacing_mode mode);
+
+// Set the main loop rate for the configured mode. Call before the renderer is created.
+void frame_pacing_initialize(const config_params_s *conf);
+
+// Whether the renderer should wait for vblank when presenting
+int frame_pacing_uses_vsync(void);
+
+// Update the refresh rate used for estimating vblank times, 0 if unknown
+void frame_pacing_set_refresh_rate(float refresh_rate);
+
+// Whether a changed screen should be presented on this iteration
+int frame_pacing_should_present(void);
+
+// Latency measurement points
+void frame_pacing_input_sent(void);
+void frame_pacing_screen_changed(void);
+void frame_pacing_presented(void);
+
+// Log latency histograms, called periodically
+void frame_pacing_log_stats(void);
+
+#endif
@@ -0,0 +1,237 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#include "framebuffer.h"
+
+// Changed regions are merged when this many are tracked already
+#define MAX_DIRTY_RECTS 32
+
+static SDL_Texture *texture = NULL;
+static Uint32 *pixels = NULL;
+static int fb_width, fb_height;
+
+static const struct inline_font *glyph_font = NULL;
+
+static SDL_Rect dirty_rects[MAX_DIRTY_RECTS];
+static int dirty_count = 0;
+
+static struct {
+  Uint32 uploads;
+  Uint64 bytes;
+} stats;
+
+static Uint32 pack_color(SDL_Color color) {
+  return (Uint32)color.a << 24 | (Uint32)color.r << 16 | (Uint32)color.g << 8 | color.b;
+}
+
+static int rect_area(const SDL_Rect *rect) { return rect->w * rect->h; }
+
+static SDL_Rect rect_union(const SDL_Rect *a, const SDL_Rect *b) {
+  const int x0 = SDL_min(a->x, b->x), y0 = SDL_min(a->y, b->y);
+  const int x1 = SDL_max(a->x + a->w, b->x + b->w), y1 = SDL_max(a->y + a->h, b->y + b->h);
+  return (SDL_Rect){x0, y0, x1 - x0, y1 - y0};
+}
+
+// Clip a rectangle to the framebuffer, returns 0 if nothing is left
+static int clip_to_framebuffer(int x0, int y0, int x1, int y1, SDL_Rect *rect) {
+  x0 = SDL_max(x0, 0);
+  y0 = SDL_max(y0, 0);
+  x1 = SDL_min(x1, fb_width);
+  y1 = SDL_min(y1, fb_height);
+  *rect = (SDL_Rect){x0, y0, x1 - x0, y1 - y0};
+  return x0 < x1 && y0 < y1;
+}
+
+static void mark_dirty(const SDL_Rect *rect) {
+  SDL_Rect merged = *rect;
+
+  // Absorb tracked regions that the new one overlaps or lines up with without wasting area
+  for (int i = 0; i < dirty_count;) {
+    const SDL_Rect candidate = rect_union(&merged, &dirty_rects[i]);
+    if (rect_area(&candidate) <= rect_area(&merged) + rect_area(&dirty_rects[i])) {
+      merged = candidate;
+      dirty_rects[i] = dirty_rects[--dirty_count];
+      i = 0;
+    } else {
+      i++;
+    }
+  }
+
+  if (dirty_count == MAX_DIRTY_RECTS) {
+    // Grow the region that needs the least extra area instead
+    int best = 0, best_growth = SDL_MAX_SINT32;
+    for (int i = 0; i < dirty_count; i++) {
+      const SDL_Rect candidate = rect_union(&merged, &dirty_rects[i]);
+      const int growth = rect_area(&candidate) - rect_area(&dirty_rects[i]);
+      if (growth < best_growth) {
+        best = i;
+        best_growth = growth;
+      }
+    }
+    merged = rect_union(&merged, &dirty_rects[best]);
+    dirty_rects[best] = dirty_rects[--dirty_count];
+  }
+
+  dirty_rects[dirty_count++] = merged;
+}
+
+static void release_buffers(void) {
+  if (texture != NULL) {
+    SDL_DestroyTexture(texture);
+    texture = NULL;
+  }
+  SDL_free(pixels);
+  pixels = NULL;
+  dirty_count = 0;
+}
+
+int framebuffer_initialize(SDL_Renderer *renderer, int width, int height) {
+  // Also used for resizing, the selected font is kept
+  release_buffers();
+
+  pixels = SDL_calloc((size_t)width * height, sizeof(Uint32));
+  if (pixels == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Couldn't allocate framebuffer");
+    return 0;
+  }
+
+  texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING,
+                              width, height);
+  if (texture == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Couldn't create framebuffer texture: %s",
+                 SDL_GetError());
+    SDL_free(pixels);
+    pixels = NULL;
+    return 0;
+  }
+
+  fb_width = width;
+  fb_height = height;
+  dirty_count = 0;
+  mark_dirty(&(SDL_Rect){0, 0, width, height});
+  return 1;
+}
+
+void framebuffer_destroy(void) {
+  release_buffers();
+  glyph_font = NULL;
+}
+
+SDL_Texture *framebuffer_get_texture(void) { return texture; }
+
+int framebuffer_set_font(const struct inline_font *font) {
+  glyph_font = font;
+  return 1;
+}
+
+void framebuffer_clear(SDL_Color color) {
+  if (pixels == NULL) {
+    return;
+  }
+  const Uint32 value = pack_color(color);
+  for (int i = 0; i < fb_width * fb_height; i++) {
+    pixels[i] = value;
+  }
+  dirty_count = 0;
+  mark_dirty(&(SDL_Rect){0, 0, fb_width, fb_height});
+}
+
+void framebuffer_fill_rect(const SDL_FRect *rect, SDL_Color color) {
+  SDL_Rect area;
+  if (pixels == NULL || !clip_to_framebuffer((int)rect->x, (int)rect->y, (int)(rect->x + rect->w),
+                                             (int)(rect->y + rect->h), &area)) {
+    return;
+  }
+
+  const Uint32 value = pack_color(color);
+  for (int y = area.y; y < area.y + area.h; y++) {
+    Uint32 *row = &pixels[y * fb_width];
+    for (int x = area.x; x < area.x + area.w; x++) {
+      row[x] = value;
+    }
+  }
+  mark_dirty(&area);
+}
+
+void framebuffer_draw_glyph(float x, float y, const SDL_FRect *source, SDL_Color color) {
+  const int src_x = (int)source->x, src_y = (int)source->y;
+  const int w = (int)source->w, h = (int)source->h;
+  SDL_Rect area;
+
+  if (pixels == NULL || glyph_font == NULL || src_x < 0 || src_y < 0 ||
+      src_x + w > glyph_font->width || src_y + h > glyph_font->height ||
+      !clip_to_framebuffer((int)x, (int)y, (int)x + w, (int)y + h, &area)) {
+    return;
+  }
+
+  // The glyphs are stored as bits, set ones take the color and clear ones are transparent
+  const Uint32 value = pack_color(color);
+  for (int dy = area.y; dy < area.y + area.h; dy++) {
+    const int font_y = src_y + dy - (int)y;
+    Uint32 *dst = &pixels[dy * fb_width];
+    for (int dx = area.x; dx < area.x + area.w; dx++) {
+      if (fonts_texel(glyph_font, src_x + dx - (int)x, font_y)) {
+        dst[dx] = value;
+      }
+    }
+  }
+  mark_dirty(&area);
+}
+
+void framebuffer_draw_columns(int x, const Uint8 *top, const Uint8 *bottom, int count,
+                             SDL_Color color) {
+  if (pixels == NULL || count <= 0) {
+    return;
+  }
+
+  const Uint32 value = pack_color(color);
+  int x0 = fb_width, y0 = fb_height, x1 = 0, y1 = 0;
+  for (int i = 0; i < count; i++) {
+    const int column = x + i;
+    const int y_end = SDL_min((int)bottom[i] + 1, fb_height);
+    if (column < 0 || column >= fb_width) {
+      continue;
+    }
+    for (int y = top[i]; y < y_end; y++) {
+      pixels[y * fb_width + column] = value;
+    }
+    x0 = SDL_min(x0, column);
+    y0 = SDL_min(y0, (int)top[i]);
+    x1 = SDL_max(x1, column + 1);
+    y1 = SDL_max(y1, y_end);
+  }
+
+  SDL_Rect area;
+  if (clip_to_framebuffer(x0, y0, x1, y1, &area)) {
+    mark_dirty(&area);
+  }
+}
+
+const Uint32 *framebuffer_get_pixels(void) { return pixels; }
+
+void framebuffer_upload(void) {
+  if (texture == NULL) {
+    return;
+  }
+  for (int i = 0; i < dirty_count; i++) {
+    const SDL_Rect *rect = &dirty_rects[i];
+    if (!SDL_UpdateTexture(texture, rect, &pixels[rect->y * fb_width + rect->x],
+                           fb_width * (int)sizeof(Uint32))) {
+      SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Couldn't update framebuffer texture: %s",
+                   SDL_GetError());
+    }
+    stats.uploads++;
+    stats.bytes += (Uint64)rect_area(rect) * sizeof(Uint32);
+  }
+  dirty_count = 0;
+}
+
+void framebuffer_log_stats(int frames) {
+  if (frames <= 0 || texture == NULL) {
+    return;
+  }
+  SDL_LogDebug(SDL_LOG_CATEGORY_RENDER, "Framebuffer: %.1f uploads/frame, %.1f KiB/frame",
+               (float)stats.uploads / frames, (float)stats.bytes / 1024.0f / frames);
+  stats.uploads = 0;
+  stats.bytes = 0;
+}
@@ -0,0 +1,39 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#ifndef FRAMEBUFFER_H_
+#define FRAMEBUFFER_H_
+
+#include "fonts/fonts.h"
+#include <SDL3/SDL.h>
+
+// CPU-side renderer: M8 draw commands are rasterized into an ARGB8888 buffer in system memory
+// and only the changed regions are uploaded to a streaming texture.
+
+int framebuffer_initialize(SDL_Renderer *renderer, int width, int height);
+void framebuffer_destroy(void);
+
+// Streaming texture holding the uploaded framebuffer
+SDL_Texture *framebuffer_get_texture(void);
+
+// Select the font used by framebuffer_draw_glyph(). Returns 1 on success.
+int framebuffer_set_font(const struct inline_font *font);
+
+void framebuffer_clear(SDL_Color color);
+void framebuffer_fill_rect(const SDL_FRect *rect, SDL_Color color);
+// Draw a glyph from the font, unset pixels are transparent like in inprint()
+void framebuffer_draw_glyph(float x, float y, const SDL_FRect *source, SDL_Color color);
+// Draw one pixel wide columns starting at x, column i covers the rows top[i]..bottom[i]
+void framebuffer_draw_columns(int x, const Uint8 *top, const Uint8 *bottom, int count,
+                             SDL_Color color);
+
+// The framebuffer contents, ARGB8888 with a pitch of width * 4 bytes
+const Uint32 *framebuffer_get_pixels(void);
+
+// Upload the regions changed since the last call to the texture
+void framebuffer_upload(void);
+
+// Log uploads and uploaded data, averaged over the given number of frames
+void framebuffer_log_stats(int frames);
+
+#endif
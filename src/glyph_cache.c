@@ -0,0 +1,220 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#include "glyph_cache.h"
+
+#define ATLAS_WIDTH 512
+#define ATLAS_HEIGHT 512
+#define MAX_ENTRIES 1024
+#define HASH_BUCKETS 256 // Power of two
+
+// Must match the font bitmap layout in inprint2.c
+#define CHARACTERS_PER_ROW 94
+
+typedef struct {
+  const struct inline_font *font;
+  int ascii_code;
+  Uint32 fgcolor;
+  Uint32 bgcolor;
+  int lru_prev, lru_next; // Most recently used entry is at lru_head
+  int bucket_next;
+} glyph_entry_s;
+
+static SDL_Texture *atlas = NULL;
+static SDL_Renderer *atlas_renderer = NULL;
+static int cell_w, cell_h, atlas_columns, capacity;
+
+static glyph_entry_s entries[MAX_ENTRIES];
+static int entry_count = 0;
+static int buckets[HASH_BUCKETS];
+static int lru_head = -1, lru_tail = -1;
+
+static struct {
+  Uint32 hits;
+  Uint32 misses;
+  Uint32 evictions;
+} stats;
+
+static unsigned int hash_key(const struct inline_font *font, int ascii_code, Uint32 fgcolor,
+                             Uint32 bgcolor) {
+  Uint32 h = (Uint32)(uintptr_t)font * 0x9E3779B1u;
+  h = (h ^ (Uint32)ascii_code) * 0x85EBCA6Bu;
+  h = (h ^ fgcolor) * 0xC2B2AE35u;
+  h = (h ^ bgcolor) * 0x9E3779B1u;
+  return (h ^ h >> 16) & (HASH_BUCKETS - 1);
+}
+
+static void lru_unlink(int index) {
+  glyph_entry_s *entry = &entries[index];
+  if (entry->lru_prev >= 0) {
+    entries[entry->lru_prev].lru_next = entry->lru_next;
+  } else {
+    lru_head = entry->lru_next;
+  }
+  if (entry->lru_next >= 0) {
+    entries[entry->lru_next].lru_prev = entry->lru_prev;
+  } else {
+    lru_tail = entry->lru_prev;
+  }
+}
+
+static void lru_push_front(int index) {
+  entries[index].lru_prev = -1;
+  entries[index].lru_next = lru_head;
+  if (lru_head >= 0) {
+    entries[lru_head].lru_prev = index;
+  }
+  lru_head = index;
+  if (lru_tail < 0) {
+    lru_tail = index;
+  }
+}
+
+static void bucket_remove(int index) {
+  const glyph_entry_s *entry = &entries[index];
+  int *link = &buckets[hash_key(entry->font, entry->ascii_code, entry->fgcolor, entry->bgcolor)];
+  while (*link != index) {
+    link = &entries[*link].bucket_next;
+  }
+  *link = entry->bucket_next;
+}
+
+static SDL_FRect cell_rect(int index) {
+  const int column = index % atlas_columns, row = index / atlas_columns;
+  return (SDL_FRect){(float)(column * cell_w), (float)(row * cell_h), (float)cell_w, (float)cell_h};
+}
+
+static int create_atlas(SDL_Renderer *renderer) {
+  // Use one cell size for all fonts so that the layout survives font changes
+  size_t font_count;
+  const struct inline_font *const *fonts = fonts_all(&font_count);
+  cell_w = 0;
+  cell_h = 0;
+  for (size_t i = 0; i < font_count; i++) {
+    cell_w = SDL_max(cell_w, SDL_max(fonts[i]->glyph_x, fonts[i]->width / CHARACTERS_PER_ROW));
+    cell_h = SDL_max(cell_h, SDL_max(fonts[i]->glyph_y, fonts[i]->height));
+  }
+
+  atlas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+                            ATLAS_WIDTH, ATLAS_HEIGHT);
+  if (atlas == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Couldn't create glyph atlas: %s", SDL_GetError());
+    return 0;
+  }
+  SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+  SDL_SetTextureScaleMode(atlas, SDL_SCALEMODE_NEAREST);
+
+  atlas_renderer = renderer;
+  atlas_columns = ATLAS_WIDTH / cell_w;
+  capacity = SDL_min(atlas_columns * (ATLAS_HEIGHT / cell_h), MAX_ENTRIES);
+  glyph_cache_invalidate();
+  return 1;
+}
+
+// Render a character and its background into an atlas cell
+static void render_entry(int index, SDL_Texture *font_texture, const SDL_FRect *source) {
+  const glyph_entry_s *entry = &entries[index];
+  const SDL_FRect cell = cell_rect(index);
+  SDL_Texture *previous_target = SDL_GetRenderTarget(atlas_renderer);
+
+  SDL_SetRenderTarget(atlas_renderer, atlas);
+
+  // Only the background rectangle is opaque, the rest of the cell stays transparent
+  SDL_SetRenderDrawBlendMode(atlas_renderer, SDL_BLENDMODE_NONE);
+  SDL_SetRenderDrawColor(atlas_renderer, 0, 0, 0, 0);
+  SDL_RenderFillRect(atlas_renderer, &cell);
+  if (entry->bgcolor != entry->fgcolor) {
+    SDL_SetRenderDrawColor(atlas_renderer, (entry->bgcolor & 0x00FF0000) >> 16,
+                           (entry->bgcolor & 0x0000FF00) >> 8, entry->bgcolor & 0x000000FF, 0xFF);
+    SDL_RenderFillRect(atlas_renderer, &(SDL_FRect){cell.x, cell.y, (float)entry->font->glyph_x,
+                                                    (float)entry->font->glyph_y});
+  }
+
+  // Whitespace has no glyph in the font
+  if (entry->ascii_code != 32) {
+    Uint8 r, g, b;
+    SDL_GetTextureColorMod(font_texture, &r, &g, &b);
+    SDL_SetTextureColorMod(font_texture, (entry->fgcolor & 0x00FF0000) >> 16,
+                           (entry->fgcolor & 0x0000FF00) >> 8, entry->fgcolor & 0x000000FF);
+    SDL_RenderTexture(atlas_renderer, font_texture, source,
+                      &(SDL_FRect){cell.x, cell.y, source->w, source->h});
+    SDL_SetTextureColorMod(font_texture, r, g, b);
+  }
+
+  SDL_SetRenderTarget(atlas_renderer, previous_target);
+}
+
+int glyph_cache_draw(SDL_Renderer *renderer, const struct inline_font *font,
+                     SDL_Texture *font_texture, int ascii_code, const SDL_FRect *source, float x,
+                     float y, Uint32 fgcolor, Uint32 bgcolor) {
+  if (atlas == NULL && !create_atlas(renderer)) {
+    return 0;
+  }
+  if (renderer != atlas_renderer) {
+    return 0;
+  }
+
+  const unsigned int bucket = hash_key(font, ascii_code, fgcolor, bgcolor);
+  int index = buckets[bucket];
+  while (index >= 0) {
+    const glyph_entry_s *entry = &entries[index];
+    if (entry->font == font && entry->ascii_code == ascii_code && entry->fgcolor == fgcolor &&
+        entry->bgcolor == bgcolor) {
+      break;
+    }
+    index = entry->bucket_next;
+  }
+
+  if (index >= 0) {
+    stats.hits++;
+    lru_unlink(index);
+  } else {
+    stats.misses++;
+    if (entry_count < capacity) {
+      index = entry_count++;
+    } else {
+      index = lru_tail;
+      stats.evictions++;
+      lru_unlink(index);
+      bucket_remove(index);
+    }
+    entries[index] = (glyph_entry_s){font, ascii_code, fgcolor, bgcolor, -1, -1, buckets[bucket]};
+    buckets[bucket] = index;
+    render_entry(index, font_texture, source);
+  }
+  lru_push_front(index);
+
+  const SDL_FRect cell = cell_rect(index);
+  return SDL_RenderTexture(renderer, atlas, &cell, &(SDL_FRect){x, y, cell.w, cell.h});
+}
+
+void glyph_cache_invalidate(void) {
+  for (int i = 0; i < HASH_BUCKETS; i++) {
+    buckets[i] = -1;
+  }
+  entry_count = 0;
+  lru_head = -1;
+  lru_tail = -1;
+}
+
+void glyph_cache_destroy(void) {
+  if (atlas != NULL) {
+    SDL_DestroyTexture(atlas);
+    atlas = NULL;
+  }
+  atlas_renderer = NULL;
+  glyph_cache_invalidate();
+}
+
+void glyph_cache_log_stats(void) {
+  const Uint32 lookups = stats.hits + stats.misses;
+  if (lookups == 0) {
+    return;
+  }
+  SDL_LogDebug(SDL_LOG_CATEGORY_RENDER, "Glyph cache: %.1f%% hits of %u, %u evictions, %d/%d used",
+               100.0f * (float)stats.hits / (float)lookups, lookups, stats.evictions, entry_count,
+               capacity);
+  stats.hits = 0;
+  stats.misses = 0;
+  stats.evictions = 0;
+}
@@ -0,0 +1,29 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#ifndef GLYPH_CACHE_H_
+#define GLYPH_CACHE_H_
+
+#include "fonts/fonts.h"
+#include <SDL3/SDL.h>
+
+// Atlas of pre-rendered characters keyed by (font, character, foreground, background), so that
+// each cached character is drawn with a single texture copy. Least recently used entries are
+// replaced when the atlas is full.
+
+// Draw a character at x, y like inprint() does. The glyph is copied from source in font_texture
+// and the background is transparent if bgcolor equals fgcolor. Returns 0 if the character could
+// not be drawn from the cache and must be drawn directly.
+int glyph_cache_draw(SDL_Renderer *renderer, const struct inline_font *font,
+                     SDL_Texture *font_texture, int ascii_code, const SDL_FRect *source, float x,
+                     float y, Uint32 fgcolor, Uint32 bgcolor);
+
+// Forget all cached characters, e.g. after a font or theme change
+void glyph_cache_invalidate(void);
+
+void glyph_cache_destroy(void);
+
+// Log hit rate and evictions since the previous call
+void glyph_cache_log_stats(void);
+
+#endif
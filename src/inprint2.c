@@ -2,52 +2,102 @@
 // https://github.com/driedfruit/SDL_inprint Released into public domain.
 // Modified to support multiple fonts & adding a background to text.
 
+#include "SDL2_inprint.h"
 #include "fonts/fonts.h"
+#include "glyph_cache.h"
 #include <SDL3/SDL.h>
 
 #define CHARACTERS_PER_ROW 94
 #define CHARACTERS_PER_COLUMN 1
 
+#define MAX_FONTS 8
+
 // Offset for seeking from limited character sets
 static const int font_offset = 127 - CHARACTERS_PER_ROW * CHARACTERS_PER_COLUMN;
 
 static SDL_Renderer *selected_renderer = NULL;
-static SDL_Texture *inline_font = NULL;
+static SDL_Texture *font_textures[MAX_FONTS]; // One texture per embedded font, by font index
+static size_t loaded_fonts = 0;
+static size_t selected_index = 0;
+static SDL_Texture *inline_font = NULL; // Texture of the selected inline font
 static SDL_Texture *selected_font = NULL;
 static const struct inline_font *selected_inline_font;
 static Uint16 selected_font_w, selected_font_h;
-
-void inline_font_initialize(const struct inline_font *font) {
-
-  if (inline_font != NULL) {
-    return;
+// Color modulation last set on selected_font, each font texture keeps its own
+static Uint32 previous_fgcolor;
+static int previous_fgcolor_valid = 0;
+
+static SDL_Texture *load_font_texture(const struct inline_font *font) {
+  Uint32 *pixels = SDL_malloc(sizeof(Uint32) * (size_t)font->width * (size_t)font->height);
+  if (pixels == NULL) {
+    return NULL;
+  }
+  // White glyphs, everything else is transparent
+  fonts_unpack(font, pixels, 0xFFFFFFFF, 0x00000000);
+
+  SDL_Texture *texture = SDL_CreateTexture(selected_renderer, SDL_PIXELFORMAT_ARGB8888,
+                                           SDL_TEXTUREACCESS_STATIC, font->width, font->height);
+  if (texture == NULL || !SDL_UpdateTexture(texture, NULL, pixels, font->width * 4)) {
+    SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Couldn't create font texture: %s", SDL_GetError());
+    SDL_DestroyTexture(texture);
+    texture = NULL;
+  } else {
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
   }
 
-  selected_inline_font = font;
-  selected_font_w = selected_inline_font->width;
-  selected_font_h = selected_inline_font->height;
-
-  SDL_IOStream *font_bmp =
-      SDL_IOFromConstMem(selected_inline_font->image_data, selected_inline_font->image_size);
+  SDL_free(pixels);
+  return texture;
+}
 
-  SDL_Surface *surface = SDL_LoadBMP_IO(font_bmp, 1);
+int inline_fonts_load(SDL_Renderer *renderer) {
+  inline_fonts_unload();
+  selected_renderer = renderer;
+
+  size_t count;
+  const struct inline_font *const *fonts = fonts_all(&count);
+  for (loaded_fonts = 0; loaded_fonts < SDL_min(count, MAX_FONTS); loaded_fonts++) {
+    font_textures[loaded_fonts] = load_font_texture(fonts[loaded_fonts]);
+    if (font_textures[loaded_fonts] == NULL) {
+      inline_fonts_unload();
+      return 0;
+    }
+  }
 
-  // Black is transparent
-  SDL_SetSurfaceColorKey(surface, true, SDL_MapSurfaceRGB(surface, 0, 0, 0));
+  inline_font_select(selected_index);
+  return 1;
+}
 
-  inline_font = SDL_CreateTextureFromSurface(selected_renderer, surface);
+void inline_fonts_unload(void) {
+  for (size_t i = 0; i < loaded_fonts; i++) {
+    SDL_DestroyTexture(font_textures[i]);
+    font_textures[i] = NULL;
+  }
+  loaded_fonts = 0;
+  if (selected_font == inline_font) {
+    selected_font = NULL;
+  }
+  inline_font = NULL;
+}
 
-  SDL_DestroySurface(surface);
+void inline_font_select(const size_t index) {
+  if (index >= loaded_fonts) {
+    return;
+  }
 
+  selected_index = index;
+  selected_inline_font = fonts_get(index);
+  selected_font_w = selected_inline_font->width;
+  selected_font_h = selected_inline_font->height;
+  inline_font = font_textures[index];
   selected_font = inline_font;
+  previous_fgcolor_valid = 0;
 }
 
-void inline_font_close(void) {
-  SDL_DestroyTexture(inline_font);
-  inline_font = NULL;
-}
+size_t inline_font_get_current_index(void) { return selected_index; }
 
-void inline_font_set_renderer(SDL_Renderer *renderer) { selected_renderer = renderer; }
+SDL_Texture *inline_font_get_font_texture(const size_t index) {
+  return index < loaded_fonts ? font_textures[index] : NULL;
+}
 
 void infont(SDL_Texture *font) {
 
@@ -63,6 +113,7 @@ void infont(SDL_Texture *font) {
   selected_font = font;
   selected_font_w = w;
   selected_font_h = h;
+  previous_fgcolor_valid = 0;
 }
 void incolor1(const SDL_Color *color) {
   SDL_SetTextureColorMod(selected_font, color->r, color->g, color->b);
@@ -81,8 +132,6 @@ void inprint(SDL_Renderer *dst, const char *str, Uint32 x, Uint32 y, const Uint3
   SDL_FRect d_rect;
   SDL_FRect bg_rect;
 
-  static uint32_t previous_fgcolor;
-
   d_rect.x = (float)x;
   d_rect.y = (float)y;
   s_rect.w = (float)selected_font_w / CHARACTERS_PER_ROW;
@@ -111,9 +160,18 @@ void inprint(SDL_Renderer *dst, const char *str, Uint32 x, Uint32 y, const Uint3
       d_rect.y += s_rect.h + 1;
       continue;
     }
-    if (fgcolor != previous_fgcolor) {
+    // Characters of the inline font are drawn from the glyph cache when possible
+    if (selected_font == inline_font &&
+        glyph_cache_draw(dst, selected_inline_font, selected_font, ascii_code, &s_rect, d_rect.x,
+                         d_rect.y, fgcolor, bgcolor)) {
+      d_rect.x += (float)selected_inline_font->glyph_x + 1;
+      continue;
+    }
+
+    if (!previous_fgcolor_valid || fgcolor != previous_fgcolor) {
       incolor(fgcolor);
       previous_fgcolor = fgcolor;
+      previous_fgcolor_valid = 1;
     }
 
     if (bgcolor != fgcolor) {
@@ -136,3 +194,20 @@ void inprint(SDL_Renderer *dst, const char *str, Uint32 x, Uint32 y, const Uint3
 const struct inline_font *inline_font_get_current(void) {
   return selected_inline_font;
 }
+
+SDL_Texture *inline_font_get_texture(void) { return selected_font; }
+
+int inline_font_glyph_rect(const int ascii_code, SDL_FRect *rect) {
+  const int id = ascii_code - font_offset;
+
+  // Whitespace and characters outside the font have no glyph
+  if (id < 0 || id >= CHARACTERS_PER_ROW * CHARACTERS_PER_COLUMN) {
+    return 0;
+  }
+
+  rect->w = (float)selected_font_w / CHARACTERS_PER_ROW;
+  rect->h = (float)selected_font_h / CHARACTERS_PER_COLUMN;
+  rect->x = (float)(id % CHARACTERS_PER_ROW) * rect->w;
+  rect->y = (float)(id / CHARACTERS_PER_ROW) * rect->h;
+  return 1;
+}
@@ -3,10 +3,14 @@
 //
 #include "input.h"
 #include "backends/audio.h"
+#include "backends/audio_recorder.h"
 #include "backends/m8.h"
 #include "common.h"
+#include "frame_pacing.h"
 #include "render.h"
 #include "log_overlay.h"
+#include "stats_overlay.h"
+#include "video_recorder.h"
 #include <SDL3/SDL.h>
 
 static unsigned char keyjazz_enabled = 0;
@@ -168,6 +172,38 @@ static input_msg_s handle_m8_keys(const SDL_Event *event, const config_params_s
   return key;
 }
 
+// Start or stop recording the screen, with the audio when it is enabled
+static void toggle_video_recording(const config_params_s *conf) {
+  static int audio_started_with_video = 0;
+  char path[1024];
+
+  if (video_recorder_is_recording()) {
+    renderer_stop_video_recording();
+    if (audio_started_with_video && audio_recorder_is_recording()) {
+      audio_record_stop();
+    }
+    audio_started_with_video = 0;
+    return;
+  }
+
+  // Both files get the same timestamped name
+  audio_started_with_video = 0;
+  if (conf->audio_enabled && !audio_recorder_is_recording()) {
+    audio_recorder_default_path(path, sizeof(path), conf->audio_record_raw ? "raw" : "wav");
+    audio_started_with_video = audio_record_start(path);
+  }
+  audio_recorder_default_path(path, sizeof(path), conf->video_record_raw ? "rgb" : "y4m");
+
+  // Frame 0 starts with the first audio sample
+  const Uint64 origin_ns =
+      audio_recorder_is_recording() ? audio_recorder_start_time_ns() : SDL_GetTicksNS();
+  if (!renderer_start_video_recording(path, conf->video_record_fps, origin_ns) &&
+      audio_started_with_video) {
+    audio_record_stop();
+    audio_started_with_video = 0;
+  }
+}
+
 /**
  * Handles the key down events during the application runtime.
  *
@@ -201,12 +237,33 @@ void input_handle_key_down_event(struct app_context *ctx, const SDL_Event *event
     return;
   }
 
+  if (event->key.scancode == ctx->conf.key_toggle_stats) {
+    stats_overlay_toggle();
+    return;
+  }
+
   if (event->key.scancode == ctx->conf.key_toggle_audio && ctx->device_connected) {
     ctx->conf.audio_enabled = !ctx->conf.audio_enabled;
     audio_toggle(ctx->conf.audio_device_name, ctx->conf.audio_buffer_size);
     return;
   }
 
+  if (event->key.scancode == ctx->conf.key_toggle_audio_record && ctx->device_connected) {
+    if (audio_recorder_is_recording()) {
+      audio_record_stop();
+    } else {
+      char path[1024];
+      audio_recorder_default_path(path, sizeof(path), ctx->conf.audio_record_raw ? "raw" : "wav");
+      audio_record_start(path);
+    }
+    return;
+  }
+
+  if (event->key.scancode == ctx->conf.key_toggle_video_record && ctx->device_connected) {
+    toggle_video_recording(&ctx->conf);
+    return;
+  }
+
   if (event->key.scancode == ctx->conf.key_reset && ctx->device_connected && !keyjazz_enabled) {
     m8_reset_display();
     return;
@@ -360,6 +417,7 @@ int input_process_and_send(const struct app_context *ctx) {
     if (input.value != prev_input) {
       prev_input = input.value;
       m8_send_msg_controller(input.value);
+      frame_pacing_input_sent();
     }
     break;
   case keyjazz:
@@ -367,6 +425,7 @@ int input_process_and_send(const struct app_context *ctx) {
       if (input.value != prev_input) {
         prev_input = input.value;
         m8_send_msg_keyjazz(input.value, keyjazz_velocity);
+        frame_pacing_input_sent();
       }
     } else {
       m8_send_msg_keyjazz(0xFF, 0);
@@ -11,19 +11,33 @@
 
 #define LOG_BUFFER_MAX_LINES 512
 #define LOG_LINE_MAX_CHARS 256
+#define LOG_OVERLAY_MARGIN_X 2
+#define LOG_OVERLAY_MARGIN_Y 1
 
-static SDL_Texture *overlay_texture = NULL;
+// The overlay is kept in one of two textures. Scrolling copies the rows that stay visible from
+// the front texture to the back one, after which the two swap roles.
+static SDL_Texture *overlay_textures[2] = {NULL, NULL};
+static int front = 0;
 static int overlay_visible = 0;
-static int overlay_needs_redraw = 0;
+static int overlay_needs_redraw = 0; // Repaint everything instead of appending new lines
+static int rows_on_screen = 0;
+static Uint64 rendered_total = 0; // log_line_total when the overlay was last updated
 
 static char log_lines[LOG_BUFFER_MAX_LINES][LOG_LINE_MAX_CHARS];
 static int log_line_start = 0;
 static int log_line_count = 0;
+static Uint64 log_line_total = 0; // Lines appended since startup
 
-static SDL_LogOutputFunction prev_log_output_fn = NULL;
-static void *prev_log_output_userdata = NULL;
 static SDL_Mutex *log_mutex = NULL; // Mutex for protecting log buffer
 
+typedef struct {
+  const struct inline_font *font;
+  int width;
+  int line_height;
+  int cols;     // Characters per row, longer lines are wrapped
+  int max_rows; // Rows that fit on the overlay
+} overlay_layout_s;
+
 static void log_buffer_append_line(const char *line) {
   if (line[0] == '\0') {
     return;
@@ -38,37 +52,24 @@ static void log_buffer_append_line(const char *line) {
   } else {
     log_line_start = (log_line_start + 1) % LOG_BUFFER_MAX_LINES;
   }
-  overlay_needs_redraw = 1;
+  log_line_total++;
   if (log_mutex)
     SDL_UnlockMutex(log_mutex);
 }
 
-static void sdl_log_capture(void *userdata, int category, SDL_LogPriority priority,
-                            const char *message) {
-  // Suppress unused variable warnings
-  (void)userdata;
-  (void)category;
-  (void)priority;
-
+void log_overlay_append(const char *message) {
   char formatted[LOG_LINE_MAX_CHARS];
   SDL_snprintf(formatted, sizeof(formatted), ">%s", message ? message : "");
   log_buffer_append_line(formatted);
-
-  if (prev_log_output_fn != NULL) {
-    prev_log_output_fn(prev_log_output_userdata, category, priority, message);
-  }
 }
 
 void log_overlay_init(void) {
-  // Create synchronization primitive before hooking log output
   if (!log_mutex) {
     log_mutex = SDL_CreateMutex();
     if (!log_mutex) {
       SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create log mutex: %s", SDL_GetError());
     }
   }
-  SDL_GetLogOutputFunction(&prev_log_output_fn, &prev_log_output_userdata);
-  SDL_SetLogOutputFunction(sdl_log_capture, NULL);
 }
 
 void log_overlay_toggle(void) {
@@ -80,195 +81,209 @@ void log_overlay_toggle(void) {
 int log_overlay_is_visible(void) { return overlay_visible; }
 
 void log_overlay_invalidate(void) {
-  if (overlay_texture != NULL) {
-    SDL_DestroyTexture(overlay_texture);
-    overlay_texture = NULL;
+  for (int i = 0; i < 2; i++) {
+    if (overlay_textures[i] != NULL) {
+      SDL_DestroyTexture(overlay_textures[i]);
+      overlay_textures[i] = NULL;
+    }
   }
   overlay_needs_redraw = 1;
 }
 
 void log_overlay_destroy(void) {
-  // Restore previous log output function
-  if (prev_log_output_fn) {
-    SDL_SetLogOutputFunction(prev_log_output_fn, prev_log_output_userdata);
-    prev_log_output_fn = NULL;
-    prev_log_output_userdata = NULL;
-  }
-  if (overlay_texture != NULL) {
-    SDL_DestroyTexture(overlay_texture);
-    overlay_texture = NULL;
-  }
+  log_overlay_invalidate();
   // Destroy synchronization primitive
   if (log_mutex) {
     SDL_DestroyMutex(log_mutex);
     log_mutex = NULL;
   }
-  overlay_needs_redraw = 1;
 }
 
-void log_overlay_render(SDL_Renderer *renderer, int logical_texture_width,
-                        int logical_texture_height, SDL_ScaleMode scale_mode,
-                        int font_mode_current) {
-  if (!overlay_visible) {
-    return;
-  }
-  if (overlay_texture == NULL) {
-    overlay_texture =
-        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
-                          logical_texture_width, logical_texture_height);
-    if (overlay_texture == NULL) {
+static int create_textures(SDL_Renderer *renderer, int width, int height,
+                           SDL_ScaleMode scale_mode) {
+  for (int i = 0; i < 2; i++) {
+    overlay_textures[i] = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                            SDL_TEXTUREACCESS_TARGET, width, height);
+    if (overlay_textures[i] == NULL) {
       SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Couldn't create log texture: %s", SDL_GetError());
-      return;
+      log_overlay_invalidate();
+      return 0;
     }
-    SDL_SetTextureBlendMode(overlay_texture, SDL_BLENDMODE_BLEND);
-    SDL_SetTextureScaleMode(overlay_texture, scale_mode);
+    SDL_SetTextureBlendMode(overlay_textures[i], SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(overlay_textures[i], scale_mode);
   }
+  front = 0;
+  overlay_needs_redraw = 1;
+  return 1;
+}
 
-  // Only update the overlay texture when its contents changed.
-  if (overlay_needs_redraw) {
-    overlay_needs_redraw = 0;
+static void clear_texture(SDL_Renderer *renderer, SDL_Texture *texture) {
+  if (!SDL_SetRenderTarget(renderer, texture)) {
+    SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Failed to set render target: %s", SDL_GetError());
+  }
+  SDL_SetRenderDrawColor(renderer, 0, 0, 0, 220);
+  SDL_RenderClear(renderer);
+}
 
-    // Take a snapshot of the log ring buffer so we can render without holding the mutex.
-    // This prevents data races and avoids deadlocks if rendering logs internally.
-    int local_count = 0;
-    int local_start = 0;
-    if (log_mutex)
-      SDL_LockMutex(log_mutex);
-    local_count = log_line_count;
-    local_start = log_line_start;
-
-    // Snapshot holds copies of each visible line in chronological order.
-    char(*snapshot)[LOG_LINE_MAX_CHARS] = NULL;
-    if (local_count > 0) {
-      snapshot = (char(*)[LOG_LINE_MAX_CHARS])SDL_calloc((size_t)local_count, sizeof(log_lines[0]));
-    }
-    if (snapshot) {
-      for (int i = 0; i < local_count; i++) {
-        const int idx = (local_start + i) % LOG_BUFFER_MAX_LINES;
-        SDL_strlcpy(snapshot[i], log_lines[idx], LOG_LINE_MAX_CHARS);
-      }
+// Caller holds log_mutex
+static const char *line_at(Uint64 line) {
+  const Uint64 oldest = log_line_total - (Uint64)log_line_count;
+  return log_lines[(log_line_start + (int)(line - oldest)) % LOG_BUFFER_MAX_LINES];
+}
+
+static int rows_for_line(const char *line, int cols) {
+  return SDL_max(1, ((int)SDL_strlen(line) + cols - 1) / cols);
+}
+
+// Draw one row of text straight from the font texture
+static void draw_row(SDL_Renderer *renderer, const overlay_layout_s *layout, const char *text,
+                     size_t length, int row) {
+  const struct inline_font *font = layout->font;
+  SDL_Texture *font_texture = inline_font_get_font_texture(0);
+  SDL_FRect source = {0, 0, (float)font->glyph_width, (float)font->height};
+  SDL_FRect dest = {(float)LOG_OVERLAY_MARGIN_X,
+                    (float)(LOG_OVERLAY_MARGIN_Y + row * layout->line_height), source.w,
+                    source.h};
+
+  for (size_t i = 0; i < length; i++, dest.x += (float)(font->glyph_x + 1)) {
+    const int id = (unsigned char)text[i] - FONTS_FIRST_CHARACTER;
+    // Whitespace and characters outside the font have no glyph
+    if (id < 0 || id >= FONTS_GLYPH_COUNT) {
+      continue;
     }
-    if (log_mutex)
-      SDL_UnlockMutex(log_mutex);
+    source.x = (float)id * source.w;
+    SDL_RenderTexture(renderer, font_texture, &source, &dest);
+  }
+}
 
-    // Bind the overlay texture as the render target and clear it with a translucent background.
-    SDL_Texture *prev_target = SDL_GetRenderTarget(renderer);
-    if (!SDL_SetRenderTarget(renderer, overlay_texture)) {
-      SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Failed to set render target: %s", SDL_GetError());
+// Append lines from line onwards below the rows already on screen, skipping the first offset
+// characters of the first line. The front texture must be the render target.
+static void draw_lines(SDL_Renderer *renderer, const overlay_layout_s *layout, Uint64 line,
+                       size_t offset) {
+  for (; line < log_line_total && rows_on_screen < layout->max_rows; line++, offset = 0) {
+    const char *text = line_at(line);
+    const size_t length = SDL_strlen(text);
+    for (size_t pos = offset; pos < length && rows_on_screen < layout->max_rows;
+         pos += (size_t)layout->cols) {
+      draw_row(renderer, layout, text + pos, SDL_min((size_t)layout->cols, length - pos),
+               rows_on_screen++);
     }
+  }
+}
 
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 220);
-    SDL_RenderClear(renderer);
-
-    // Switch to a small font for the overlay; remember previous mode to restore later.
-    const int prev_font_mode = font_mode_current;
-    inline_font_close();
-    const struct inline_font *font_small = fonts_get(0);
-    if (font_small) {
-      inline_font_initialize(font_small);
-
-      // Layout calculations:
-      // - glyph_x/y = character cell size in pixels.
-      // - margin_x/y = inner padding around the overlay.
-      // - cols = how many characters fit per line (accounting for a 1px inter-glyph gap).
-      const int line_height = font_small->glyph_y + 1;
-      const int margin_x = 2;
-      const int margin_y = 1;
-      const int usable_width = logical_texture_width - (margin_x * 2);
-      const int cols = SDL_max(1, usable_width / (font_small->glyph_x + 1));
-
-      // Determine how many text rows fit on the screen vertically.
-      const int max_rows = (logical_texture_height - margin_y * 2) / line_height;
-
-      // We want to show the newest content; walk backwards over the snapshot to find
-      // which line (and intra-line character offset) should be the first visible row,
-      // so that the last max_rows rows are visible.
-      int rows_needed = max_rows;
-      int start_idx = 0;            // index in snapshot[] to start drawing from
-      size_t start_char_offset = 0; // per-line character offset (for wrapped lines)
-
-      if (local_count > 0) {
-        for (int n = local_count - 1; n >= 0 && rows_needed > 0; n--) {
-          if (!snapshot) break; // nullptr safety
-          const size_t len = SDL_strlen(snapshot[n]);
-          // How many wrapped rows this line consumes
-          const int rows_for_line = SDL_max(1, (int)((len + cols - 1) / cols));
-          if (rows_for_line >= rows_needed) {
-            // This line provides the first visible portion.
-            // Compute which character to start from so we only draw the last rows_needed rows.
-            const int offset = SDL_max(0, (int)len - rows_needed * cols);
-            start_idx = n;
-            start_char_offset = (size_t)offset;
-            break;
-          }
-          // Not enough rows on this line, include it fully and continue upwards.
-          rows_needed -= rows_for_line;
-          start_idx = n;
-          start_char_offset = 0;
-        }
-      }
-
-      // Render loop:
-      // - Iterate from start_idx to the newest item (end of snapshot).
-      // - For each line, draw it in chunks of `cols` characters (word-wrap by fixed width).
-      // - Stop when we run out of vertical space.
-      if (local_count > 0) {
-        int y = margin_y;
-        size_t offset = start_char_offset;
-
-        for (int cur = start_idx; cur < local_count && y < logical_texture_height; cur++) {
-          if (!snapshot || cur < 0 || cur >= local_count) {
-            break;
-          }
-
-          const char *s = snapshot[cur];
-          const size_t len = SDL_strlen(s);
-
-          for (size_t pos = offset; pos < len && y < logical_texture_height;) {
-            const Uint32 fg = 0xFFFFFF; // draw text in white
-            const size_t remaining = len - pos;
-
-            // Take up to `cols` characters for this visual row
-            size_t take = (size_t)cols < remaining ? (size_t)cols : remaining;
-
-            // Copy the slice into a temporary buffer for printing
-            char buf[LOG_LINE_MAX_CHARS];
-            if (take >= sizeof(buf)) {
-              take = sizeof(buf) - 1;
-            }
-            SDL_memcpy(buf, s + pos, take);
-            buf[take] = '\0';
-
-            // Draw the row and advance one line vertically
-            inprint(renderer, buf, margin_x, y, fg, fg);
-            y += line_height;
-            pos += take;
-          }
-
-          // After the first (possibly partial) slice of this line, subsequent lines start at 0
-          offset = 0;
-        }
-      }
-    } else {
-      SDL_LogError(SDL_LOG_CATEGORY_RENDER, "fonts_get(0) returned NULL");
+// Clear the overlay and draw as many of the newest lines as fit
+static void repaint(SDL_Renderer *renderer, const overlay_layout_s *layout) {
+  clear_texture(renderer, overlay_textures[front]);
+  rows_on_screen = 0;
+
+  // Walk backwards from the newest line to find the first visible row
+  const Uint64 oldest = log_line_total - (Uint64)log_line_count;
+  Uint64 first = log_line_total;
+  size_t offset = 0;
+  int rows_needed = layout->max_rows;
+  while (first > oldest && rows_needed > 0) {
+    const char *text = line_at(first - 1);
+    const int rows = rows_for_line(text, layout->cols);
+    first--;
+    if (rows >= rows_needed) {
+      // Only the last rows_needed rows of this line are visible
+      offset = (size_t)(rows - rows_needed) * (size_t)layout->cols;
+      break;
     }
+    rows_needed -= rows;
+  }
+  draw_lines(renderer, layout, first, offset);
+}
 
-    // Restore previous font mode and previous render target.
-    inline_font_close();
-    inline_font_initialize(fonts_get(prev_font_mode));
-    SDL_SetRenderTarget(renderer, prev_target);
+// Move the visible rows up by count rows, freeing space at the bottom
+static void scroll(SDL_Renderer *renderer, const overlay_layout_s *layout, int count) {
+  SDL_Texture *source = overlay_textures[front];
+  front = !front;
+  clear_texture(renderer, overlay_textures[front]);
+
+  const float y = (float)LOG_OVERLAY_MARGIN_Y;
+  const float kept_height = (float)((rows_on_screen - count) * layout->line_height);
+  const SDL_FRect from = {0, y + (float)(count * layout->line_height), (float)layout->width,
+                          kept_height};
+  const SDL_FRect to = {0, y, (float)layout->width, kept_height};
+  // Copy the pixels as they are, including the translucent background
+  SDL_SetTextureBlendMode(source, SDL_BLENDMODE_NONE);
+  SDL_RenderTexture(renderer, source, &from, &to);
+  SDL_SetTextureBlendMode(source, SDL_BLENDMODE_BLEND);
+  rows_on_screen -= count;
+}
 
-    // Free the snapshot after rendering.
-    if (snapshot) {
-      SDL_free(snapshot);
-    }
+// Bring the overlay up to date with the log buffer. Caller holds log_mutex.
+static void update_overlay(SDL_Renderer *renderer, const overlay_layout_s *layout) {
+  const Uint64 oldest = log_line_total - (Uint64)log_line_count;
+  if (overlay_needs_redraw || rendered_total < oldest) {
+    // Lines that were never drawn have already left the buffer
+    repaint(renderer, layout);
+    return;
+  }
+
+  int new_rows = 0;
+  for (Uint64 line = rendered_total; line < log_line_total && new_rows < layout->max_rows;
+       line++) {
+    new_rows += rows_for_line(line_at(line), layout->cols);
+  }
+  if (new_rows >= layout->max_rows) {
+    repaint(renderer, layout);
+    return;
+  }
+
+  const int overflow = rows_on_screen + new_rows - layout->max_rows;
+  if (overflow > 0) {
+    scroll(renderer, layout, overflow);
+  } else if (!SDL_SetRenderTarget(renderer, overlay_textures[front])) {
+    SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Failed to set render target: %s", SDL_GetError());
+  }
+  draw_lines(renderer, layout, rendered_total, 0);
+}
+
+void log_overlay_render(SDL_Renderer *renderer, int logical_texture_width,
+                        int logical_texture_height, SDL_ScaleMode scale_mode) {
+  if (!overlay_visible) {
+    return;
+  }
+
+  overlay_layout_s layout = {fonts_get(0), logical_texture_width, 0, 0, 0};
+  if (layout.font == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_RENDER, "fonts_get(0) returned NULL");
+    return;
+  }
+  layout.line_height = layout.font->glyph_y + 1;
+  layout.cols = SDL_max(1, (logical_texture_width - LOG_OVERLAY_MARGIN_X * 2) /
+                               (layout.font->glyph_x + 1));
+  layout.max_rows = (logical_texture_height - LOG_OVERLAY_MARGIN_Y * 2) / layout.line_height;
+
+  if (overlay_textures[front] == NULL &&
+      !create_textures(renderer, logical_texture_width, logical_texture_height, scale_mode)) {
+    return;
+  }
+  SDL_Texture *font_texture = inline_font_get_font_texture(0);
+  if (font_texture == NULL) {
+    return;
+  }
+
+  // The log thread waits while new lines are drawn, so they can be read in place
+  if (log_mutex)
+    SDL_LockMutex(log_mutex);
+  if (overlay_needs_redraw || rendered_total != log_line_total) {
+    SDL_Texture *prev_target = SDL_GetRenderTarget(renderer);
+    // The font texture is shared, other text may have left a color on it
+    SDL_SetTextureColorMod(font_texture, 255, 255, 255);
+    update_overlay(renderer, &layout);
+    overlay_needs_redraw = 0;
+    rendered_total = log_line_total;
+    SDL_SetRenderTarget(renderer, prev_target);
   }
+  if (log_mutex)
+    SDL_UnlockMutex(log_mutex);
 
   // Composite the overlay texture to the current render target every frame while visible.
-  if (overlay_texture) {
-    if (!SDL_RenderTexture(renderer, overlay_texture, NULL, NULL)) {
-      SDL_LogCritical(SDL_LOG_CATEGORY_RENDER, "Couldn't render log overlay texture: %s",
-                      SDL_GetError());
-    }
+  if (!SDL_RenderTexture(renderer, overlay_textures[front], NULL, NULL)) {
+    SDL_LogCritical(SDL_LOG_CATEGORY_RENDER, "Couldn't render log overlay texture: %s",
+                    SDL_GetError());
   }
 }
@@ -6,9 +6,12 @@
 
 #include <SDL3/SDL.h>
 
-// Initialize SDL log capture to mirror messages into the in-app overlay buffer
+// Create the overlay line buffer. Messages are fed to it by the log pipeline.
 void log_overlay_init(void);
 
+// Append a log message to the overlay buffer, safe to call from any thread
+void log_overlay_append(const char *message);
+
 // Toggle overlay visibility
 void log_overlay_toggle(void);
 
@@ -21,13 +24,12 @@ void log_overlay_invalidate(void);
 // Destroy internal resources used by the overlay
 void log_overlay_destroy(void);
 
-// Ensure the overlay texture is up to date and composite it to the current render target
-// font_mode_current is used to restore the caller's font after drawing
+// Draw any new log lines to the overlay texture and composite it to the current render target.
+// Only new lines are drawn, the rows already on the overlay are scrolled up to make room.
 void log_overlay_render(SDL_Renderer *renderer,
 			   int logical_texture_width,
 			   int logical_texture_height,
-			   SDL_ScaleMode texture_scaling_mode,
-			   int font_mode_current);
+			   SDL_ScaleMode texture_scaling_mode);
 
 #endif // LOG_OVERLAY_H_
 
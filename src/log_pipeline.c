@@ -0,0 +1,254 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#include "log_pipeline.h"
+
+#include "log_overlay.h"
+
+// Records in the ring, a power of two. Messages are dropped and counted when it is full.
+#define LOG_RING_SIZE 512
+#define LOG_RING_MASK (LOG_RING_SIZE - 1)
+SDL_COMPILE_TIME_ASSERT(log_ring_size_pow2, (LOG_RING_SIZE & LOG_RING_MASK) == 0);
+// Longer messages are truncated. Also fits the largest M8 packet, a 480 sample waveform.
+#define LOG_RECORD_MAX_BYTES 512
+#define LOG_PACKET_DUMPS_PER_SECOND 10
+#define LOG_CONSUMER_TIMEOUT_MS 100
+
+enum log_record_type { LOG_RECORD_TEXT, LOG_RECORD_PACKET };
+
+typedef struct {
+  // Equals the ring position when free, position + 1 when written and ready for the consumer
+  SDL_AtomicInt sequence;
+  enum log_record_type type;
+  int category;
+  SDL_LogPriority priority;
+  Uint32 length;     // Message length, or the original size of a packet
+  Uint32 suppressed; // Packet dumps skipped by the rate limit before this one
+  char data[LOG_RECORD_MAX_BYTES];
+} log_record_s;
+
+// Bounded multi-producer queue: producers claim a position with a compare-and-swap and publish
+// the record through its sequence number. There is a single consumer thread.
+static log_record_s records[LOG_RING_SIZE];
+static SDL_ALIGNED(SDL_CACHELINE_SIZE) SDL_AtomicInt write_position;
+static SDL_AtomicInt dropped;
+static SDL_ALIGNED(SDL_CACHELINE_SIZE) int read_position;
+
+static SDL_Semaphore *wakeup = NULL;
+static SDL_Thread *consumer_thread = NULL;
+static SDL_AtomicInt running;
+
+static SDL_LogOutputFunction prev_log_output_fn = NULL;
+static void *prev_log_output_userdata = NULL;
+
+// Packet dump rate limit, shared by all producers
+static SDL_AtomicU32 packet_window_start;
+static SDL_AtomicInt packet_window_count;
+static SDL_AtomicInt packets_suppressed;
+
+// Claim a free record. Returns NULL when the ring is full.
+static log_record_s *reserve_record(int *position) {
+  int pos = SDL_GetAtomicInt(&write_position);
+  for (;;) {
+    log_record_s *record = &records[pos & LOG_RING_MASK];
+    const int diff = (int)((Uint32)SDL_GetAtomicInt(&record->sequence) - (Uint32)pos);
+    if (diff == 0) {
+      if (SDL_CompareAndSwapAtomicInt(&write_position, pos, pos + 1)) {
+        *position = pos;
+        return record;
+      }
+    } else if (diff < 0) {
+      SDL_AddAtomicInt(&dropped, 1);
+      return NULL;
+    }
+    // Another producer got this position first
+    pos = SDL_GetAtomicInt(&write_position);
+  }
+}
+
+static void publish_record(log_record_s *record, int position) {
+  SDL_SetAtomicInt(&record->sequence, position + 1);
+  SDL_SignalSemaphore(wakeup);
+}
+
+// Called by SDL on the logging thread, the message has already been formatted
+static void SDLCALL log_enqueue(void *userdata, int category, SDL_LogPriority priority,
+                                const char *message) {
+  (void)userdata;
+
+  int position;
+  log_record_s *record = reserve_record(&position);
+  if (record == NULL) {
+    return;
+  }
+  const size_t length = message ? SDL_min(SDL_strlen(message), LOG_RECORD_MAX_BYTES - 1) : 0;
+  if (length > 0) {
+    SDL_memcpy(record->data, message, length);
+  }
+  record->data[length] = '\0';
+  record->type = LOG_RECORD_TEXT;
+  record->category = category;
+  record->priority = priority;
+  record->length = (Uint32)length;
+  publish_record(record, position);
+}
+
+static void format_packet(char *line, size_t line_size, const Uint8 *data, Uint32 size,
+                          Uint32 stored, Uint32 suppressed) {
+  static const char hex[] = "0123456789ABCDEF";
+  size_t n;
+  if (suppressed > 0) {
+    n = (size_t)SDL_snprintf(line, line_size, "Packet (%u bytes, %u earlier dumps suppressed):",
+                             size, suppressed);
+  } else {
+    n = (size_t)SDL_snprintf(line, line_size, "Packet (%u bytes):", size);
+  }
+  for (Uint32 i = 0; i < stored && n + 6 < line_size; i++) {
+    line[n++] = ' ';
+    line[n++] = '0';
+    line[n++] = 'x';
+    line[n++] = hex[data[i] >> 4];
+    line[n++] = hex[data[i] & 0x0F];
+  }
+  if (stored < size && n + 4 < line_size) {
+    SDL_memcpy(line + n, " ...", 4);
+    n += 4;
+  }
+  line[SDL_min(n, line_size - 1)] = '\0';
+}
+
+static void output(int category, SDL_LogPriority priority, const char *message) {
+  if (prev_log_output_fn != NULL) {
+    prev_log_output_fn(prev_log_output_userdata, category, priority, message);
+  }
+  log_overlay_append(message);
+}
+
+static void output_record(const log_record_s *record) {
+  if (record->type == LOG_RECORD_TEXT) {
+    output(record->category, record->priority, record->data);
+    return;
+  }
+  // 5 characters per byte plus the header
+  static char line[LOG_RECORD_MAX_BYTES * 5 + 64];
+  format_packet(line, sizeof(line), (const Uint8 *)record->data, record->length,
+                SDL_min(record->length, LOG_RECORD_MAX_BYTES), record->suppressed);
+  output(record->category, record->priority, line);
+}
+
+// Consumer thread only
+static void drain_records(void) {
+  for (;;) {
+    log_record_s *record = &records[read_position & LOG_RING_MASK];
+    if (SDL_GetAtomicInt(&record->sequence) != read_position + 1) {
+      break;
+    }
+    output_record(record);
+    SDL_SetAtomicInt(&record->sequence, read_position + LOG_RING_SIZE);
+    read_position++;
+  }
+
+  const int lost = SDL_SetAtomicInt(&dropped, 0);
+  if (lost > 0) {
+    char line[64];
+    SDL_snprintf(line, sizeof(line), "%d log messages dropped", lost);
+    output(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_WARN, line);
+  }
+}
+
+static int SDLCALL consumer_loop(void *data) {
+  (void)data;
+  while (SDL_GetAtomicInt(&running)) {
+    SDL_WaitSemaphoreTimeout(wakeup, LOG_CONSUMER_TIMEOUT_MS);
+    drain_records();
+  }
+  drain_records();
+  return 0;
+}
+
+int log_pipeline_init(void) {
+  if (consumer_thread != NULL) {
+    return 1;
+  }
+  for (int i = 0; i < LOG_RING_SIZE; i++) {
+    SDL_SetAtomicInt(&records[i].sequence, i);
+  }
+  SDL_SetAtomicInt(&write_position, 0);
+  read_position = 0;
+
+  wakeup = SDL_CreateSemaphore(0);
+  if (wakeup == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create log semaphore: %s",
+                 SDL_GetError());
+    return 0;
+  }
+  SDL_SetAtomicInt(&running, 1);
+  consumer_thread = SDL_CreateThread(consumer_loop, "log", NULL);
+  if (consumer_thread == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create log thread: %s", SDL_GetError());
+    SDL_SetAtomicInt(&running, 0);
+    SDL_DestroySemaphore(wakeup);
+    wakeup = NULL;
+    return 0;
+  }
+
+  SDL_GetLogOutputFunction(&prev_log_output_fn, &prev_log_output_userdata);
+  SDL_SetLogOutputFunction(log_enqueue, NULL);
+  return 1;
+}
+
+void log_pipeline_close(void) {
+  if (consumer_thread == NULL) {
+    return;
+  }
+  // SDL holds its log lock while calling the output function, so no producer is left in
+  // log_enqueue() once this returns
+  SDL_SetLogOutputFunction(prev_log_output_fn, prev_log_output_userdata);
+
+  SDL_SetAtomicInt(&running, 0);
+  SDL_SignalSemaphore(wakeup);
+  SDL_WaitThread(consumer_thread, NULL);
+  consumer_thread = NULL;
+  SDL_DestroySemaphore(wakeup);
+  wakeup = NULL;
+}
+
+void log_packet(int category, const Uint8 *data, Uint32 size) {
+  if (SDL_GetLogPriority(category) > SDL_LOG_PRIORITY_DEBUG) {
+    return;
+  }
+
+  const Uint32 now = (Uint32)SDL_GetTicks();
+  const Uint32 window_start = SDL_GetAtomicU32(&packet_window_start);
+  if (now - window_start >= 1000 &&
+      SDL_CompareAndSwapAtomicU32(&packet_window_start, window_start, now)) {
+    SDL_SetAtomicInt(&packet_window_count, 0);
+  }
+  if (SDL_AddAtomicInt(&packet_window_count, 1) >= LOG_PACKET_DUMPS_PER_SECOND) {
+    SDL_AddAtomicInt(&packets_suppressed, 1);
+    return;
+  }
+  const Uint32 suppressed = (Uint32)SDL_SetAtomicInt(&packets_suppressed, 0);
+  const Uint32 stored = SDL_min(size, LOG_RECORD_MAX_BYTES);
+
+  if (consumer_thread == NULL) {
+    // No pipeline, format in place
+    char line[LOG_RECORD_MAX_BYTES * 5 + 64];
+    format_packet(line, sizeof(line), data, size, stored, suppressed);
+    SDL_LogDebug(category, "%s", line);
+    return;
+  }
+
+  int position;
+  log_record_s *record = reserve_record(&position);
+  if (record == NULL) {
+    return;
+  }
+  SDL_memcpy(record->data, data, stored);
+  record->type = LOG_RECORD_PACKET;
+  record->category = category;
+  record->priority = SDL_LOG_PRIORITY_DEBUG;
+  record->length = size;
+  record->suppressed = suppressed;
+  publish_record(record, position);
+}
@@ -0,0 +1,23 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#ifndef LOG_PIPELINE_H_
+#define LOG_PIPELINE_H_
+
+#include <SDL3/SDL.h>
+
+// Asynchronous log output. SDL log messages from any thread are copied into a lock-free ring and
+// written out by a background thread, which passes them to the previous SDL log output function
+// and to the log overlay. Logging never waits on the console or on the overlay's lock.
+
+// Hook SDL log output and start the consumer thread. Returns 1 on success.
+int log_pipeline_init(void);
+
+// Write out anything still queued, stop the consumer thread and restore the previous log output
+void log_pipeline_close(void);
+
+// Log a packet as a hex dump at debug priority. Only the raw bytes are queued, the consumer
+// thread formats them. Dumps beyond a few per second are counted and reported with the next one.
+void log_packet(int category, const Uint8 *data, Uint32 size);
+
+#endif // LOG_PIPELINE_H_
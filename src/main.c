@@ -14,12 +14,22 @@
 
 #include "SDL2_inprint.h"
 #include "backends/audio.h"
+#include "backends/audio_latency.h"
+#include "backends/capture.h"
 #include "backends/m8.h"
+#ifdef USE_REPLAY
+#include "backends/replay.h"
+#endif
 #include "common.h"
 #include "config.h"
+#include "frame_pacing.h"
 #include "gamepads.h"
 #include "render.h"
 #include "log_overlay.h"
+#include "log_pipeline.h"
+#include "stats.h"
+#include "stats_overlay.h"
+#include "trace.h"
 
 static void do_wait_for_device(struct app_context *ctx) {
   static Uint64 ticks_poll_device = 0;
@@ -39,7 +49,7 @@ static void do_wait_for_device(struct app_context *ctx) {
   // Poll for M8 device every second
   if (ctx->device_connected == 0 && SDL_GetTicks() - ticks_poll_device > 1000) {
     ticks_poll_device = SDL_GetTicks();
-    if (m8_initialize(0, ctx->preferred_device)) {
+    if (m8_initialize(0, ctx->preferred_device, &ctx->conf)) {
 
       if (ctx->conf.audio_enabled) {
         if (!audio_initialize(ctx->conf.audio_device_name, ctx->conf.audio_buffer_size)) {
@@ -86,7 +96,28 @@ static config_params_s initialize_config(int argc, char *argv[], char **preferre
       *config_filename = argv[i + 1];
       SDL_Log("Using config file: %s", *config_filename);
       i++;
+    } else if (SDL_strcmp(argv[i], "--capture") == 0 && i + 1 < argc) {
+      capture_start(argv[i + 1]);
+      i++;
+    } else if (SDL_strcmp(argv[i], "--stats") == 0 && i + 1 < argc) {
+      stats_open_json(argv[i + 1]);
+      i++;
+    } else if (SDL_strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+      if (trace_start(argv[i + 1])) {
+        trace_name_thread("main");
+      }
+      i++;
+    }
+#ifdef USE_REPLAY
+    else if (SDL_strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+      // The replay backend reads the capture file in place of a device
+      *preferred_device = argv[i + 1];
+      i++;
+    } else if (SDL_strcmp(argv[i], "--replay-mode") == 0 && i + 1 < argc) {
+      replay_set_mode(argv[i + 1]);
+      i++;
     }
+#endif
   }
 
   config_params_s conf = config_initialize(*config_filename);
@@ -109,6 +140,11 @@ SDL_AppResult SDL_AppIterate(void *appstate) {
   struct app_context *ctx = appstate;
   SDL_AppResult app_result = SDL_APP_CONTINUE;
 
+  if (stats_update()) {
+    stats_overlay_update();
+  }
+  trace_flush();
+
   switch (ctx->app_state) {
   case INITIALIZE:
     break;
@@ -122,7 +158,9 @@ SDL_AppResult SDL_AppIterate(void *appstate) {
     if (ctx->app_suspended) {
       return SDL_APP_CONTINUE;
     }
+    const Uint64 trace = trace_begin();
     const int result = m8_process_data(&ctx->conf);
+    trace_end("m8_process_data", trace);
     if (result == DEVICE_DISCONNECTED) {
       ctx->device_connected = 0;
       ctx->app_state = WAIT_FOR_DEVICE;
@@ -150,6 +188,7 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv) {
 
   // Initialize in-app log capture/overlay
   log_overlay_init();
+  log_pipeline_init();
 
 #ifndef NDEBUG
   // Show debug messages in the application log
@@ -160,9 +199,6 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv) {
   SDL_SetLogPriorities(SDL_LOG_PRIORITY_INFO);
 #endif
 
-  // Process the application's main callback roughly at 120 Hz
-  SDL_SetHint(SDL_HINT_MAIN_CALLBACK_RATE, "120");
-
   struct app_context *ctx = SDL_calloc(1, sizeof(struct app_context));
   if (ctx == NULL) {
     SDL_LogCritical(SDL_LOG_CATEGORY_SYSTEM, "SDL_calloc failed: %s", SDL_GetError());
@@ -173,13 +209,18 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv) {
   ctx->app_state = INITIALIZE;
   ctx->conf = initialize_config(argc, argv, &ctx->preferred_device, &config_filename);
 
+  // Sets the rate of the application's main callback
+  frame_pacing_initialize(&ctx->conf);
+  audio_latency_set_target(ctx->conf.audio_latency_ms);
+  audio_set_passthrough(ctx->conf.audio_passthrough);
+
   if (!renderer_initialize(&ctx->conf)) {
     SDL_LogCritical(SDL_LOG_CATEGORY_ERROR, "Failed to initialize renderer.");
     return SDL_APP_FAILURE;
   }
 
   ctx->device_connected =
-      m8_initialize(1, ctx->preferred_device);
+      m8_initialize(1, ctx->preferred_device, &ctx->conf);
 
   if (gamepads_initialize() < 0) {
     SDL_LogCritical(SDL_LOG_CATEGORY_ERROR, "Failed to initialize game controllers.");
@@ -207,6 +248,8 @@ void SDL_AppQuit(void *appstate, SDL_AppResult result) {
   struct app_context *app = appstate;
 
   if (app) {
+    // Log synchronously from here on, the overlay is about to go away
+    log_pipeline_close();
     if (app->app_state == WAIT_FOR_DEVICE) {
       screensaver_destroy();
     }
@@ -215,10 +258,12 @@ void SDL_AppQuit(void *appstate, SDL_AppResult result) {
     }
     gamepads_close();
     renderer_close();
-    inline_font_close();
     if (app->device_connected) {
       m8_close();
     }
+    capture_stop();
+    stats_close_json();
+    trace_stop();
     SDL_free(app);
 
     SDL_Log("Shutting down.");
@@ -6,11 +6,21 @@
 #include <SDL3/SDL.h>
 
 #include "SDL2_inprint.h"
+#include "backends/audio_latency.h"
 #include "command.h"
 #include "config.h"
+#include "draw_batch.h"
+#include "frame_pacing.h"
+#include "framebuffer.h"
 #include "fx_cube.h"
+#include "glyph_cache.h"
 #include "log_overlay.h"
 #include "settings.h"
+#include "stats.h"
+#include "stats_overlay.h"
+#include "trace.h"
+#include "video_recorder.h"
+#include "waveform.h"
 
 #include "fonts/fonts.h"
 
@@ -44,10 +54,21 @@ static int cached_aspect_mode = 0; // 0=equal, 1=wider, -1=taller
 
 static int screensaver_initialized = 0;
 
+// Rasterize M8 draw commands on the CPU instead of drawing them with the render API
+static int use_framebuffer = 0;
+
 uint8_t fullscreen = 0;
 
 static uint8_t dirty = 0;
 
+// The waveform on screen, an identical one is skipped while nothing has been drawn over it
+static struct {
+  Uint8 samples[WAVEFORM_MAX_SAMPLES];
+  int size;
+  struct color color;
+  int valid;
+} last_waveform = {0};
+
 // Update cached destination rectangle and aspect mode for non-integer scaling
 static void update_cached_scaling(int window_width, int window_height) {
   const float texture_aspect_ratio = (float)texture_width / (float)texture_height;
@@ -73,6 +94,14 @@ static void update_cached_scaling(int window_width, int window_height) {
   }
 }
 
+// Set the scale mode of the textures holding the M8 screen
+static void set_screen_scale_mode(const SDL_ScaleMode mode) {
+  SDL_SetTextureScaleMode(main_texture, mode);
+  if (framebuffer_get_texture() != NULL) {
+    SDL_SetTextureScaleMode(framebuffer_get_texture(), mode);
+  }
+}
+
 void setup_hd_texture_scaling(void) {
   // Fullscreen scaling: use an intermediate texture with the highest possible integer size factor
 
@@ -94,7 +123,7 @@ void setup_hd_texture_scaling(void) {
   SDL_SetRenderTarget(rend, NULL);
   // SDL forces black borders in letterbox mode, so in HD mode the texture scaling is manual
   SDL_SetRenderLogicalPresentation(rend, 0, 0, SDL_LOGICAL_PRESENTATION_DISABLED);
-  SDL_SetTextureScaleMode(main_texture, SDL_SCALEMODE_NEAREST);
+  set_screen_scale_mode(SDL_SCALEMODE_NEAREST);
 
   // Check the aspect ratio to avoid unnecessary antialiasing
   if (texture_aspect_ratio == window_aspect_ratio) {
@@ -157,54 +186,94 @@ static void create_hd_texture(void) {
   setup_hd_texture_scaling();
 }
 
-static void change_font(const unsigned int index) {
-  inline_font_close();
-  inline_font_set_renderer(rend);
-  inline_font_initialize(fonts_get(index));
+// Refresh rate of the display the window is on, for estimating vblank times
+static void update_refresh_rate(void) {
+  const SDL_DisplayMode *mode = SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(win));
+  frame_pacing_set_refresh_rate(mode != NULL ? mode->refresh_rate : 0);
 }
 
-// Log overlay API wrappers
-void renderer_log_init(void) { log_overlay_init(); }
+// Texture holding the M8 screen contents. The screensaver always draws to the main texture.
+static SDL_Texture *screen_texture(void) {
+  return use_framebuffer && !screensaver_initialized ? framebuffer_get_texture() : main_texture;
+}
 
-static void check_and_adjust_window_and_texture_size(const int new_width, const int new_height) {
+// Draw the queued M8 draw commands to the main texture
+static void flush_draw_commands(void) {
+  SDL_SetRenderTarget(rend, main_texture);
+  draw_batch_flush(rend, inline_font_get_texture(), texture_width, texture_height);
+}
 
-  if (texture_width == new_width && texture_height == new_height) {
-    return;
+static void change_font(const unsigned int index) {
+  // Queued characters refer to the current font texture
+  flush_draw_commands();
+  inline_font_select(index);
+  if (use_framebuffer) {
+    framebuffer_set_font(fonts_get(index));
   }
+}
 
-  int window_h, window_w;
-
-  texture_width = new_width;
-  texture_height = new_height;
-
-  // Query window size and resize if smaller than default
-  SDL_GetWindowSize(win, &window_w, &window_h);
-  if (window_w < texture_width * 2 || window_h < texture_height * 2) {
-    SDL_SetWindowSize(win, texture_width * 2, texture_height * 2);
-  }
+// Log overlay API wrappers
+void renderer_log_init(void) { log_overlay_init(); }
 
+// Recreate the textures that depend on the screen size
+static void recreate_screen_textures(void) {
   if (hd_texture != NULL) {
     SDL_DestroyTexture(hd_texture);
     create_hd_texture(); // Create the texture dynamically based on window size
     setup_hd_texture_scaling();
   }
 
+  // Anything queued would be drawn to the texture that is about to be replaced
+  draw_batch_discard();
+  last_waveform.valid = 0;
+
   if (main_texture != NULL) {
     SDL_DestroyTexture(main_texture);
   }
 
   // Notify log overlay to drop its cached texture so it can be recreated with the new size
   log_overlay_invalidate();
+  stats_overlay_invalidate();
 
   main_texture = SDL_CreateTexture(rend, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
                                    texture_width, texture_height);
   SDL_SetTextureScaleMode(main_texture, texture_scaling_mode);
   SDL_SetRenderTarget(rend, main_texture);
 
+  if (use_framebuffer) {
+    framebuffer_initialize(rend, texture_width, texture_height);
+  }
+  set_screen_scale_mode(texture_scaling_mode);
+
   // Notify settings overlay about logical render size change so it can recreate its cache
   settings_on_texture_size_change(rend);
 }
 
+static void check_and_adjust_window_and_texture_size(const int new_width, const int new_height) {
+
+  if (texture_width == new_width && texture_height == new_height) {
+    return;
+  }
+
+  int window_h, window_w;
+
+  if (video_recorder_is_recording()) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_RENDER, "Screen size changed, stopping video recording");
+    video_recorder_stop();
+  }
+
+  texture_width = new_width;
+  texture_height = new_height;
+
+  // Query window size and resize if smaller than default
+  SDL_GetWindowSize(win, &window_w, &window_h);
+  if (window_w < texture_width * 2 || window_h < texture_height * 2) {
+    SDL_SetWindowSize(win, texture_width * 2, texture_height * 2);
+  }
+
+  recreate_screen_textures();
+}
+
 // Set the M8 hardware model in use. 0 = MK1, 1 = MK2
 void set_m8_model(const unsigned int model) {
 
@@ -235,12 +304,18 @@ void renderer_set_font_mode(int mode) {
   waveform_max_height = new_font->waveform_max_height;
 
   change_font(mode);
+  glyph_cache_invalidate();
+  last_waveform.valid = 0;
   SDL_LogDebug(SDL_LOG_CATEGORY_RENDER, "Font mode %i, Screen offset %i", mode, screen_offset_y);
 }
 
 void renderer_close(void) {
   SDL_LogDebug(SDL_LOG_CATEGORY_RENDER, "Closing renderer");
-  inline_font_close();
+  video_recorder_stop();
+  draw_batch_discard();
+  framebuffer_destroy();
+  glyph_cache_destroy();
+  inline_fonts_unload();
   if (main_texture != NULL) {
     SDL_DestroyTexture(main_texture);
   }
@@ -248,6 +323,7 @@ void renderer_close(void) {
     SDL_DestroyTexture(hd_texture);
   }
   log_overlay_destroy();
+  stats_overlay_destroy();
   SDL_DestroyRenderer(rend);
   SDL_DestroyWindow(win);
 }
@@ -269,12 +345,81 @@ int toggle_fullscreen(config_params_s *conf) {
   return (int)conf->init_fullscreen;
 }
 
+// Anything drawn over the waveform has to be drawn over again by the next one
+static void check_waveform_overlap(const SDL_FRect *rect) {
+  if (rect->x + rect->w > (float)(texture_width - last_waveform.size) &&
+      rect->y < (float)(waveform_max_height + 1)) {
+    last_waveform.valid = 0;
+  }
+}
+
+static void render_rectangle(const SDL_FRect *rect, const SDL_Color color) {
+  check_waveform_overlap(rect);
+  if (use_framebuffer) {
+    framebuffer_fill_rect(rect, color);
+    return;
+  }
+  if (draw_batch_is_full()) {
+    flush_draw_commands();
+  }
+  draw_batch_rect(rect, color);
+}
+
+// Draw a character like inprint() does. The background is transparent if it has the same color
+// as the foreground.
+static void render_character(const char c, const float x, const float y, const SDL_Color fgcolor,
+                             const SDL_Color bgcolor) {
+  const struct inline_font *font = inline_font_get_current();
+  const SDL_FRect background = {x, y, (float)font->glyph_x, (float)font->glyph_y};
+  const int transparent = fgcolor.r == bgcolor.r && fgcolor.g == bgcolor.g &&
+                          fgcolor.b == bgcolor.b;
+  SDL_FRect glyph_source;
+  const int has_glyph = inline_font_glyph_rect(c, &glyph_source);
+
+  check_waveform_overlap(&background);
+
+  if (use_framebuffer) {
+    if (!transparent) {
+      framebuffer_fill_rect(&background, bgcolor);
+    }
+    if (has_glyph) {
+      framebuffer_draw_glyph(x, y, &glyph_source, fgcolor);
+    }
+    return;
+  }
+
+  if (transparent && !has_glyph) {
+    return;
+  }
+
+  const SDL_FRect glyph = {x, y, glyph_source.w, glyph_source.h};
+
+  if (draw_batch_is_full()) {
+    flush_draw_commands();
+  }
+  draw_batch_character(transparent ? NULL : &background, bgcolor, &glyph,
+                       has_glyph ? &glyph_source : NULL, fgcolor);
+}
+
+static void render_text(const char *text, const int x, const int y, const SDL_Color fgcolor,
+                        const SDL_Color bgcolor) {
+  const int advance = inline_font_get_current()->glyph_x + 1;
+  for (int i = 0; text[i] != '\0'; i++) {
+    render_character(text[i], (float)(x + i * advance), (float)y, fgcolor, bgcolor);
+  }
+}
+
 int draw_character(struct draw_character_command *command) {
 
-  const uint32_t fgcolor =
-      command->foreground.r << 16 | command->foreground.g << 8 | command->foreground.b;
-  const uint32_t bgcolor =
-      command->background.r << 16 | command->background.g << 8 | command->background.b;
+  const char c = (char)command->c;
+  const SDL_Color fgcolor = {command->foreground.r, command->foreground.g, command->foreground.b,
+                             0xFF};
+  const SDL_Color bgcolor = {command->background.r, command->background.g, command->background.b,
+                             0xFF};
+
+  if (c == '\0') {
+    return 1;
+  }
 
   /* Notes:
      If a large font is enabled, offset the screen elements by a fixed amount.
@@ -282,10 +427,11 @@ int draw_character(struct draw_character_command *command) {
      background. Due to the font bitmaps, a different pixel offset is needed for
      both*/
 
-  inprint(rend, (char *)&command->c, command->pos.x,
-          command->pos.y + text_offset_y + screen_offset_y, fgcolor, bgcolor);
+  render_character(c, (float)command->pos.x,
+                   (float)(command->pos.y + text_offset_y + screen_offset_y), fgcolor, bgcolor);
 
   dirty = 1;
+  frame_pacing_screen_changed();
 
   return 1;
 }
@@ -304,6 +450,12 @@ void draw_rectangle(struct draw_rectangle_command *command) {
       render_rect.h >= (float)texture_height) {
     SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "BG color change: %d %d %d", command->color.r,
                  command->color.g, command->color.b);
+    // A different background means a theme change, the cached character colors are stale
+    if (global_background_color.r != command->color.r ||
+        global_background_color.g != command->color.g ||
+        global_background_color.b != command->color.b) {
+      glyph_cache_invalidate();
+    }
     global_background_color.r = command->color.r;
     global_background_color.g = command->color.g;
     global_background_color.b = command->color.b;
@@ -317,63 +469,48 @@ void draw_rectangle(struct draw_rectangle_command *command) {
 #endif
   }
 
-  SDL_SetRenderDrawColor(rend, command->color.r, command->color.g, command->color.b, 0xFF);
-  SDL_RenderFillRect(rend, &render_rect);
+  render_rectangle(&render_rect,
+                   (SDL_Color){command->color.r, command->color.g, command->color.b, 0xFF});
 
   dirty = 1;
+  frame_pacing_screen_changed();
 }
 
-void draw_waveform(struct draw_oscilloscope_waveform_command *command) {
-
-  static uint8_t wfm_cleared = 0;
-  static int prev_waveform_size = 0;
+void draw_waveform(const struct draw_oscilloscope_waveform_command *command) {
+  static Uint8 top[WAVEFORM_MAX_SAMPLES], bottom[WAVEFORM_MAX_SAMPLES];
+  const int size = SDL_min(command->waveform_size, WAVEFORM_MAX_SAMPLES);
 
-  // If the waveform is not being displayed, and it's already been cleared, skip rendering it
-  if (!(wfm_cleared && command->waveform_size == 0)) {
-
-    SDL_FRect wf_rect;
-    if (command->waveform_size > 0) {
-      wf_rect.x = (float)(texture_width - command->waveform_size);
-      wf_rect.y = 0;
-      wf_rect.w = command->waveform_size;
-      wf_rect.h = (float)(waveform_max_height + 1);
-    } else {
-      wf_rect.x = (float)(texture_width - prev_waveform_size);
-      wf_rect.y = 0;
-      wf_rect.w = (float)prev_waveform_size;
-      wf_rect.h = (float)(waveform_max_height + 1);
-    }
-    prev_waveform_size = command->waveform_size;
-
-    SDL_SetRenderDrawColor(rend, global_background_color.r, global_background_color.g,
-                           global_background_color.b, global_background_color.a);
-    SDL_RenderFillRect(rend, &wf_rect);
+  // The scope is sent at display rate, often unchanged
+  if (last_waveform.valid && last_waveform.size == size &&
+      SDL_memcmp(&last_waveform.color, &command->color, sizeof(command->color)) == 0 &&
+      SDL_memcmp(last_waveform.samples, command->waveform, size) == 0) {
+    return;
+  }
 
-    SDL_SetRenderDrawColor(rend, command->color.r, command->color.g, command->color.b, 255);
+  flush_draw_commands();
 
-    // Static buffer for waveform pixels (max 480 samples per M8 protocol)
-    static SDL_FPoint waveform_points[480];
+  // An empty waveform clears the previous one
+  const int clear_size = size > 0 ? size : last_waveform.size;
+  const SDL_FRect wf_rect = {(float)(texture_width - clear_size), 0, (float)clear_size,
+                             (float)(waveform_max_height + 1)};
+  const SDL_Color color = {command->color.r, command->color.g, command->color.b, 0xFF};
 
-    for (int i = 0; i < command->waveform_size; i++) {
-      // Limit value to avoid random glitches
-      if (command->waveform[i] > waveform_max_height) {
-        command->waveform[i] = waveform_max_height;
-      }
-      waveform_points[i].x = (float)i + wf_rect.x;
-      waveform_points[i].y = command->waveform[i];
-    }
+  waveform_columns(command->waveform, size, (Uint8)waveform_max_height, top, bottom);
 
-    SDL_RenderPoints(rend, waveform_points, command->waveform_size);
+  if (use_framebuffer) {
+    framebuffer_fill_rect(&wf_rect, global_background_color);
+    framebuffer_draw_columns(texture_width - size, top, bottom, size, color);
+  } else {
+    waveform_render(rend, &wf_rect, global_background_color, (float)(texture_width - size), top,
+                    bottom, size, color);
+  }
 
-    // The packet we just drew was an empty waveform
-    if (command->waveform_size == 0) {
-      wfm_cleared = 1;
-    } else {
-      wfm_cleared = 0;
-    }
+  last_waveform.valid = 1;
+  last_waveform.size = size;
+  last_waveform.color = command->color;
+  SDL_memcpy(last_waveform.samples, command->waveform, size);
 
-    dirty = 1;
-  }
+  dirty = 1;
 }
 
 void display_keyjazz_overlay(const uint8_t show, const uint8_t base_octave,
@@ -382,17 +519,18 @@ void display_keyjazz_overlay(const uint8_t show, const uint8_t base_octave,
   const struct inline_font *font = fonts_get(font_mode);
   const Uint16 overlay_offset_x = texture_width - (font->glyph_x * 7 + 1);
   const Uint16 overlay_offset_y = texture_height - (font->glyph_y + 1);
-  const Uint32 bg_color =
-      global_background_color.r << 16 | global_background_color.g << 8 | global_background_color.b;
+  const SDL_Color bg_color = {global_background_color.r, global_background_color.g,
+                              global_background_color.b, 0xFF};
+  const SDL_Color text_color = {0xC8, 0xC8, 0xC8, 0xFF};
 
   if (show) {
     char overlay_text[7];
     SDL_snprintf(overlay_text, sizeof(overlay_text), "%02X %u", velocity, base_octave);
-    inprint(rend, overlay_text, overlay_offset_x, overlay_offset_y, 0xC8C8C8, bg_color);
-    inprint(rend, "*", overlay_offset_x + (font->glyph_x * 5 + 5), overlay_offset_y,
-            0xFF0000, bg_color);
+    render_text(overlay_text, overlay_offset_x, overlay_offset_y, text_color, bg_color);
+    render_text("*", overlay_offset_x + (font->glyph_x * 5 + 5), overlay_offset_y,
+                (SDL_Color){0xFF, 0x00, 0x00, 0xFF}, bg_color);
   } else {
-    inprint(rend, "      ", overlay_offset_x, overlay_offset_y, 0xC8C8C8, bg_color);
+    render_text("      ", overlay_offset_x, overlay_offset_y, text_color, bg_color);
   }
 
   dirty = 1;
@@ -405,6 +543,11 @@ static void log_fps_stats(void) {
   if (now - ticks_fps > 5000) {
     ticks_fps = now;
     SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "%.1f fps\n", (float)fps / 5);
+    draw_batch_log_stats(fps);
+    framebuffer_log_stats(fps);
+    glyph_cache_log_stats();
+    frame_pacing_log_stats();
+    audio_latency_log_stats();
     fps = 0;
   }
 }
@@ -420,16 +563,22 @@ int renderer_initialize(config_params_s *conf) {
     return 0;
   }
 
+  // The software renderer doesn't need OpenGL, and video drivers like dummy don't provide it
+  const char *render_driver = SDL_GetHint(SDL_HINT_RENDER_DRIVER);
+  const SDL_WindowFlags opengl_flag =
+      render_driver != NULL && SDL_strcmp(render_driver, "software") == 0 ? 0 : SDL_WINDOW_OPENGL;
+
   if (!SDL_CreateWindowAndRenderer("M8C", texture_width * 2, texture_height * 2,
                                    SDL_WINDOW_RESIZABLE | SDL_WINDOW_HIGH_PIXEL_DENSITY |
-                                       SDL_WINDOW_OPENGL | conf->init_fullscreen,
+                                       opengl_flag | conf->init_fullscreen,
                                    &win, &rend)) {
     SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create window and renderer: %s",
                     SDL_GetError());
     return false;
   }
 
-  SDL_SetRenderVSync(rend, 1);
+  SDL_SetRenderVSync(rend, frame_pacing_uses_vsync() ? 1 : 0);
+  update_refresh_rate();
 
   if (!SDL_SetRenderLogicalPresentation(rend, texture_width, texture_height, window_scaling_mode)) {
     SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set renderer logical presentation: %s",
@@ -446,12 +595,18 @@ int renderer_initialize(config_params_s *conf) {
     return false;
   }
 
+  use_framebuffer = conf->framebuffer_renderer;
+  if (use_framebuffer && !framebuffer_initialize(rend, texture_width, texture_height)) {
+    SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Falling back to GPU rendering");
+    use_framebuffer = 0;
+  }
+
   if (conf->integer_scaling == 0) {
     // Create the HD texture dynamically based on window size
     create_hd_texture();
   }
 
-  SDL_SetTextureScaleMode(main_texture, texture_scaling_mode);
+  set_screen_scale_mode(texture_scaling_mode);
 
   SDL_SetRenderTarget(rend, main_texture);
 
@@ -463,6 +618,10 @@ int renderer_initialize(config_params_s *conf) {
     return 0;
   }
 
+  if (!inline_fonts_load(rend)) {
+    SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION, "Couldn't load fonts");
+    return 0;
+  }
   renderer_set_font_mode(0);
 
   SDL_SetHint(SDL_HINT_IOS_HIDE_HOME_INDICATOR, "1");
@@ -488,8 +647,25 @@ void render_screen(config_params_s *conf) {
     return;
   }
 
+  // Keep collecting changes until the frame pacing mode wants to present them
+  if (!frame_pacing_should_present()) {
+    return;
+  }
+
+  // Settings overlay redraws don't change the recorded screen
+  const uint8_t screen_changed = dirty;
   dirty = 0;
 
+  const Uint64 render_start = SDL_GetTicksNS();
+  const Uint64 trace = trace_begin();
+
+  const Uint64 trace_flush_commands = trace_begin();
+  flush_draw_commands();
+  if (use_framebuffer && !screensaver_initialized) {
+    framebuffer_upload();
+  }
+  trace_end("flush_draw_commands", trace_flush_commands);
+
   if (!SDL_SetRenderTarget(rend, NULL)) {
     SDL_LogCritical(SDL_LOG_CATEGORY_RENDER, "Couldn't set renderer target to window: %s",
                     SDL_GetError());
@@ -506,17 +682,20 @@ void render_screen(config_params_s *conf) {
 
   if (conf->integer_scaling) {
     // Direct rendering with integer scaling
-    if (!SDL_RenderTexture(rend, main_texture, NULL, NULL)) {
+    if (!SDL_RenderTexture(rend, screen_texture(), NULL, NULL)) {
       SDL_LogCritical(SDL_LOG_CATEGORY_RENDER, "Couldn't render texture: %s", SDL_GetError());
     }
 
     // Render log overlay (composites if visible)
-    log_overlay_render(rend, texture_width, texture_height, texture_scaling_mode, font_mode);
+    const Uint64 trace_overlays = trace_begin();
+    log_overlay_render(rend, texture_width, texture_height, texture_scaling_mode);
+    stats_overlay_render(rend, texture_width, texture_height, texture_scaling_mode, font_mode);
 
     // Settings overlay composited last
     if (settings_is_open()) {
       settings_render_overlay(rend, conf, texture_width, texture_height);
     }
+    trace_end("overlays", trace_overlays);
 
   } else {
     // Ensure that HD texture exists
@@ -537,18 +716,21 @@ void render_screen(config_params_s *conf) {
     }
 
     // Render the main texture to hd_texture. It has the same aspect ratio, so a NULL rect works.
-    if (!SDL_RenderTexture(rend, main_texture, NULL, NULL)) {
+    if (!SDL_RenderTexture(rend, screen_texture(), NULL, NULL)) {
       SDL_LogCritical(SDL_LOG_CATEGORY_RENDER, "Couldn't render main texture to HD texture: %s",
                       SDL_GetError());
     }
 
     // Render log overlay (composites if visible)
-    log_overlay_render(rend, texture_width, texture_height, texture_scaling_mode, font_mode);
+    const Uint64 trace_overlays = trace_begin();
+    log_overlay_render(rend, texture_width, texture_height, texture_scaling_mode);
+    stats_overlay_render(rend, texture_width, texture_height, texture_scaling_mode, font_mode);
 
     // Settings overlay composited last
     if (settings_is_open()) {
       settings_render_overlay(rend, conf, texture_width, texture_height);
     }
+    trace_end("overlays", trace_overlays);
 
     // Switch the render target back to the window
     if (!SDL_SetRenderTarget(rend, NULL)) {
@@ -565,9 +747,22 @@ void render_screen(config_params_s *conf) {
     }
   }
 
+  const Uint64 present_start = SDL_GetTicksNS();
+  const Uint64 trace_present = trace_begin();
   if (!SDL_RenderPresent(rend)) {
     SDL_LogCritical(SDL_LOG_CATEGORY_RENDER, "Couldn't present renderer: %s", SDL_GetError());
   }
+  trace_end("SDL_RenderPresent", trace_present);
+  frame_pacing_presented();
+  stats_frame(present_start - render_start, SDL_GetTicksNS() - present_start);
+
+  if (screen_changed && video_recorder_is_recording()) {
+    if (use_framebuffer && !screensaver_initialized) {
+      video_recorder_capture_pixels(framebuffer_get_pixels(), texture_width * 4, SDL_GetTicksNS());
+    } else {
+      video_recorder_capture_texture(rend, main_texture, SDL_GetTicksNS());
+    }
+  }
 
   if (!SDL_SetRenderTarget(rend, main_texture)) {
     SDL_LogCritical(SDL_LOG_CATEGORY_RENDER, "Couldn't set renderer target to texture: %s",
@@ -575,13 +770,14 @@ void render_screen(config_params_s *conf) {
   }
 
   log_fps_stats();
+  trace_end("render_screen", trace);
 }
 
 int screensaver_init(void) {
   if (screensaver_initialized) {
     return 1;
   }
-  SDL_SetRenderTarget(rend, main_texture);
+  flush_draw_commands();
   renderer_set_font_mode(1);
   global_background_color.r = 0;
   global_background_color.g = 0;
@@ -590,6 +786,7 @@ int screensaver_init(void) {
                fonts_get(font_mode)->glyph_x);
   SDL_LogDebug(SDL_LOG_CATEGORY_APPLICATION, "Screensaver initialized");
   screensaver_initialized = 1;
+  last_waveform.valid = 0;
   return 1;
 }
 
@@ -600,9 +797,11 @@ void screensaver_destroy(void) {
   renderer_set_font_mode(0);
   SDL_LogDebug(SDL_LOG_CATEGORY_APPLICATION, "Screensaver destroyed");
   screensaver_initialized = 0;
+  last_waveform.valid = 0;
 }
 
 void renderer_fix_texture_scaling_after_window_resize(config_params_s *conf) {
+  update_refresh_rate();
   SDL_SetRenderTarget(rend, NULL);
   if (conf->integer_scaling) {
     // SDL internal integer scaling works well for this purpose
@@ -614,7 +813,7 @@ void renderer_fix_texture_scaling_after_window_resize(config_params_s *conf) {
     }
     setup_hd_texture_scaling();
   }
-  SDL_SetTextureScaleMode(main_texture, texture_scaling_mode);
+  set_screen_scale_mode(texture_scaling_mode);
 }
 
 void show_error_message(const char *message) {
@@ -622,6 +821,11 @@ void show_error_message(const char *message) {
 }
 
 void renderer_clear_screen(void) {
+  draw_batch_discard();
+  last_waveform.valid = 0;
+  if (use_framebuffer) {
+    framebuffer_clear(global_background_color);
+  }
   SDL_SetRenderDrawColor(rend, global_background_color.r, global_background_color.g,
                          global_background_color.b, global_background_color.a);
   SDL_SetRenderTarget(rend, main_texture);
@@ -631,4 +835,37 @@ void renderer_clear_screen(void) {
   SDL_RenderClear(rend);
 }
 
-void renderer_request_redraw(void) { dirty = 1; }
\ No newline at end of file
+void renderer_request_redraw(void) { dirty = 1; }
+
+void renderer_on_device_reset(void) {
+  SDL_LogWarn(SDL_LOG_CATEGORY_RENDER, "Render device was reset, recreating textures");
+  const int screensaver_was_active = screensaver_initialized;
+  if (screensaver_was_active) {
+    screensaver_destroy();
+  }
+  glyph_cache_destroy();
+  video_recorder_on_device_reset();
+  if (!inline_fonts_load(rend)) {
+    SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Couldn't reload fonts after device reset");
+  }
+  recreate_screen_textures();
+  if (screensaver_was_active) {
+    screensaver_init();
+  }
+  renderer_clear_screen();
+  dirty = 1;
+}
+
+int renderer_start_video_recording(const char *path, unsigned int fps, Uint64 origin_ns) {
+  if (!video_recorder_start(path, texture_width, texture_height, fps, origin_ns)) {
+    return 0;
+  }
+  // Capture the current screen as the first frame
+  dirty = 1;
+  return 1;
+}
+
+void renderer_stop_video_recording(void) {
+  video_recorder_stop();
+  SDL_SetRenderTarget(rend, main_texture);
+}
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "command.h"
 #include "config.h"
 
+#include <SDL3/SDL.h>
 #include <stdint.h>
 
 int renderer_initialize(config_params_s *conf);
@@ -15,8 +16,14 @@ void renderer_set_font_mode(int mode);
 void renderer_fix_texture_scaling_after_window_resize(config_params_s *conf);
 void renderer_clear_screen(void);
 void renderer_request_redraw(void);
+// Recreate all textures after the render device was reset
+void renderer_on_device_reset(void);
 
-void draw_waveform(struct draw_oscilloscope_waveform_command *command);
+// Record the screen to a video file, see video_recorder.h. Returns 1 on success.
+int renderer_start_video_recording(const char *path, unsigned int fps, Uint64 origin_ns);
+void renderer_stop_video_recording(void);
+
+void draw_waveform(const struct draw_oscilloscope_waveform_command *command);
 void draw_rectangle(struct draw_rectangle_command *command);
 int draw_character(struct draw_character_command *command);
 
@@ -126,8 +126,11 @@ static void build_menu(const config_params_s *conf, setting_item_s *items, int *
     add_item(items, count, "Jazz +Vel      ", ITEM_BIND_KEY, (void *)&conf->key_jazz_inc_velocity, 0, 0, 0);
     add_item(items, count, "Jazz -Vel      ", ITEM_BIND_KEY, (void *)&conf->key_jazz_dec_velocity, 0, 0, 0);
     add_item(items, count, "Toggle audio   ", ITEM_BIND_KEY, (void *)&conf->key_toggle_audio, 0, 0, 0);
+    add_item(items, count, "Record audio   ", ITEM_BIND_KEY, (void *)&conf->key_toggle_audio_record, 0, 0, 0);
+    add_item(items, count, "Record video   ", ITEM_BIND_KEY, (void *)&conf->key_toggle_video_record, 0, 0, 0);
     add_item(items, count, "Toggle settings", ITEM_BIND_KEY, (void *)&conf->key_toggle_settings, 0, 0, 0);
     add_item(items, count, "Toggle log     ", ITEM_BIND_KEY, (void *)&conf->key_toggle_log, 0, 0, 0);
+    add_item(items, count, "Toggle stats   ", ITEM_BIND_KEY, (void *)&conf->key_toggle_stats, 0, 0, 0);
     add_item(items, count, "", ITEM_HEADER, NULL, 0, 0, 0);
     add_item(items, count, "Back", ITEM_CLOSE, NULL, 0, 0, 0);
     break;
@@ -524,19 +527,15 @@ void settings_render_overlay(SDL_Renderer *rend, const config_params_s *conf, in
   if (!g_settings.is_open)
     return;
 
-  const struct inline_font *previous_font = inline_font_get_current();
-  if (previous_font->glyph_x != fonts_get(0)->glyph_x) {
-    // Switch to small font if not active already
-    inline_font_close();
-    inline_font_initialize(fonts_get(0));
-  }
+  // Switch to the small font, fonts stay loaded so this costs nothing
+  const size_t previous_font = inline_font_get_current_index();
+  inline_font_select(0);
 
   if (g_settings.texture == NULL) {
     g_settings.texture = SDL_CreateTexture(rend, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
                                           texture_w, texture_h);
     if (g_settings.texture == NULL) {
-      inline_font_close();
-      inline_font_initialize(previous_font);
+      inline_font_select(previous_font);
       return;
     }
     SDL_SetTextureBlendMode(g_settings.texture, SDL_BLENDMODE_BLEND);
@@ -727,10 +726,7 @@ void settings_render_overlay(SDL_Renderer *rend, const config_params_s *conf, in
 
 composite:
   SDL_RenderTexture(rend, g_settings.texture, NULL, NULL);
-  if (previous_font->glyph_x != fonts_get(0)->glyph_x) {
-    inline_font_close();
-    inline_font_initialize(previous_font);
-  }
+  inline_font_select(previous_font);
 }
 
 // Handle renderer/size resets: drop the cached texture to recreate at new size on next frame
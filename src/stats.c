@@ -0,0 +1,137 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#include "stats.h"
+
+#define STATS_INTERVAL_MS 1000
+
+static const char *command_names[STATS_COMMAND_COUNT] = {
+    "rectangle", "character", "waveform", "joypad", "system_info", "invalid"};
+static const char *slip_error_names[STATS_SLIP_ERROR_COUNT] = {
+    "buffer_overflow", "unknown_escaped_byte", "invalid_packet"};
+
+// Updated by the reader threads, taken by stats_update()
+static SDL_AtomicInt bytes_received;
+static SDL_AtomicInt slip_errors[STATS_SLIP_ERROR_COUNT];
+
+// Main thread
+static Uint32 commands[STATS_COMMAND_COUNT];
+static Uint32 batches, batch_messages, batch_max;
+static unsigned int queue_high_water;
+static Uint32 frames;
+static Uint64 render_ns_total, render_ns_max;
+static Uint64 present_ns_total, present_ns_max;
+static Uint64 interval_start = 0;
+
+static stats_summary_s summary;
+static SDL_IOStream *json_io = NULL;
+
+int stats_open_json(const char *path) {
+  stats_close_json();
+  json_io = SDL_IOFromFile(path, "w");
+  if (json_io == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open stats file %s: %s", path,
+                 SDL_GetError());
+    return 0;
+  }
+  SDL_Log("Writing stats to %s", path);
+  return 1;
+}
+
+void stats_close_json(void) {
+  if (json_io != NULL) {
+    SDL_CloseIO(json_io);
+    json_io = NULL;
+  }
+}
+
+void stats_bytes_received(Uint32 count) { SDL_AddAtomicInt(&bytes_received, (int)count); }
+
+void stats_slip_error(enum stats_slip_error error) { SDL_AddAtomicInt(&slip_errors[error], 1); }
+
+void stats_command(enum stats_command command) { commands[command]++; }
+
+void stats_batch(unsigned int count, unsigned int high_water) {
+  queue_high_water = SDL_max(queue_high_water, high_water);
+  // Polls that found nothing would only dilute the average
+  if (count == 0) {
+    return;
+  }
+  batches++;
+  batch_messages += count;
+  batch_max = SDL_max(batch_max, count);
+}
+
+void stats_frame(Uint64 render_ns, Uint64 present_ns) {
+  frames++;
+  render_ns_total += render_ns;
+  render_ns_max = SDL_max(render_ns_max, render_ns);
+  present_ns_total += present_ns;
+  present_ns_max = SDL_max(present_ns_max, present_ns);
+}
+
+static void write_json(void) {
+  SDL_IOprintf(json_io, "{\"ticks\":%llu,\"seconds\":%.3f,\"commands_per_second\":{",
+               (unsigned long long)summary.ticks, summary.seconds);
+  for (int i = 0; i < STATS_COMMAND_COUNT; i++) {
+    SDL_IOprintf(json_io, "%s\"%s\":%.1f", i > 0 ? "," : "", command_names[i],
+                 summary.commands[i]);
+  }
+  SDL_IOprintf(json_io, "},\"bytes_per_second\":%.1f,\"slip_errors_per_second\":{", summary.bytes);
+  for (int i = 0; i < STATS_SLIP_ERROR_COUNT; i++) {
+    SDL_IOprintf(json_io, "%s\"%s\":%.1f", i > 0 ? "," : "", slip_error_names[i],
+                 summary.slip_errors[i]);
+  }
+  SDL_IOprintf(json_io,
+               "},\"queue_high_water\":%u,\"batch_average\":%.2f,\"batch_max\":%u,"
+               "\"fps\":%.1f,\"render_ms_average\":%.3f,\"render_ms_max\":%.3f,"
+               "\"present_ms_average\":%.3f,\"present_ms_max\":%.3f}\n",
+               summary.queue_high_water, summary.batch_average, summary.batch_max, summary.frames,
+               summary.render_ms_average, summary.render_ms_max, summary.present_ms_average,
+               summary.present_ms_max);
+  SDL_FlushIO(json_io);
+}
+
+int stats_update(void) {
+  const Uint64 now = SDL_GetTicks();
+  if (interval_start == 0) {
+    interval_start = now;
+    return 0;
+  }
+  if (now - interval_start < STATS_INTERVAL_MS) {
+    return 0;
+  }
+
+  const float seconds = (float)(now - interval_start) / 1000.0f;
+  summary.ticks = now;
+  summary.seconds = seconds;
+  for (int i = 0; i < STATS_COMMAND_COUNT; i++) {
+    summary.commands[i] = (float)commands[i] / seconds;
+    commands[i] = 0;
+  }
+  summary.bytes = (float)(Uint32)SDL_SetAtomicInt(&bytes_received, 0) / seconds;
+  for (int i = 0; i < STATS_SLIP_ERROR_COUNT; i++) {
+    summary.slip_errors[i] = (float)SDL_SetAtomicInt(&slip_errors[i], 0) / seconds;
+  }
+  summary.frames = (float)frames / seconds;
+  summary.queue_high_water = queue_high_water;
+  summary.batch_average = batches > 0 ? (float)batch_messages / (float)batches : 0.0f;
+  summary.batch_max = batch_max;
+  summary.render_ms_average = frames > 0 ? (float)render_ns_total / (float)frames / 1e6f : 0.0f;
+  summary.render_ms_max = (float)render_ns_max / 1e6f;
+  summary.present_ms_average = frames > 0 ? (float)present_ns_total / (float)frames / 1e6f : 0.0f;
+  summary.present_ms_max = (float)present_ns_max / 1e6f;
+
+  batches = batch_messages = batch_max = 0;
+  queue_high_water = 0;
+  frames = 0;
+  render_ns_total = render_ns_max = present_ns_total = present_ns_max = 0;
+  interval_start = now;
+
+  if (json_io != NULL) {
+    write_json();
+  }
+  return 1;
+}
+
+const stats_summary_s *stats_get_summary(void) { return &summary; }
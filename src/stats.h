@@ -0,0 +1,64 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#ifndef STATS_H_
+#define STATS_H_
+
+#include <SDL3/SDL.h>
+
+// Counters for the device stream and rendering, summarized once a second. The summary is shown
+// by the stats overlay and can be written to a file as JSON lines.
+
+enum stats_command {
+  STATS_COMMAND_RECTANGLE,
+  STATS_COMMAND_CHARACTER,
+  STATS_COMMAND_WAVEFORM,
+  STATS_COMMAND_JOYPAD,
+  STATS_COMMAND_SYSTEM_INFO,
+  STATS_COMMAND_INVALID,
+  STATS_COMMAND_COUNT
+};
+
+enum stats_slip_error {
+  STATS_SLIP_BUFFER_OVERFLOW,
+  STATS_SLIP_UNKNOWN_ESCAPED_BYTE,
+  STATS_SLIP_INVALID_PACKET,
+  STATS_SLIP_ERROR_COUNT
+};
+
+typedef struct {
+  Uint64 ticks; // SDL_GetTicks() at the end of the interval
+  float seconds;
+  // Per second
+  float commands[STATS_COMMAND_COUNT];
+  float bytes;
+  float slip_errors[STATS_SLIP_ERROR_COUNT];
+  float frames;
+  // Over the interval
+  unsigned int queue_high_water;
+  float batch_average;
+  unsigned int batch_max;
+  float render_ms_average, render_ms_max;
+  float present_ms_average, present_ms_max;
+} stats_summary_s;
+
+// Write a JSON line to path for every summary. Returns 1 on success.
+int stats_open_json(const char *path);
+void stats_close_json(void);
+
+// Reader threads
+void stats_bytes_received(Uint32 count);
+void stats_slip_error(enum stats_slip_error error);
+
+// Main thread
+void stats_command(enum stats_command command);
+void stats_batch(unsigned int count, unsigned int queue_high_water);
+void stats_frame(Uint64 render_ns, Uint64 present_ns);
+
+// Summarize the counters when an interval has passed, call once per main loop iteration.
+// Returns 1 when there is a new summary.
+int stats_update(void);
+
+const stats_summary_s *stats_get_summary(void);
+
+#endif
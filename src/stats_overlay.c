@@ -0,0 +1,136 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#include "stats_overlay.h"
+
+#include <SDL3/SDL.h>
+
+#include "SDL2_inprint.h"
+#include "fonts/fonts.h"
+#include "render.h"
+#include "stats.h"
+
+#define STATS_OVERLAY_LINES 8
+#define STATS_OVERLAY_LINE_CHARS 48
+
+static SDL_Texture *overlay_texture = NULL;
+static int overlay_visible = 0;
+static int overlay_needs_redraw = 0;
+
+void stats_overlay_toggle(void) {
+  overlay_visible = !overlay_visible;
+  overlay_needs_redraw = 1;
+  renderer_request_redraw();
+}
+
+int stats_overlay_is_visible(void) { return overlay_visible; }
+
+void stats_overlay_update(void) {
+  if (overlay_visible) {
+    overlay_needs_redraw = 1;
+    renderer_request_redraw();
+  }
+}
+
+void stats_overlay_invalidate(void) {
+  if (overlay_texture != NULL) {
+    SDL_DestroyTexture(overlay_texture);
+    overlay_texture = NULL;
+  }
+  overlay_needs_redraw = 1;
+}
+
+void stats_overlay_destroy(void) { stats_overlay_invalidate(); }
+
+static int format_lines(char lines[STATS_OVERLAY_LINES][STATS_OVERLAY_LINE_CHARS]) {
+  const stats_summary_s *s = stats_get_summary();
+  int n = 0;
+
+  SDL_snprintf(lines[n++], STATS_OVERLAY_LINE_CHARS, "fps     %.1f", s->frames);
+  SDL_snprintf(lines[n++], STATS_OVERLAY_LINE_CHARS, "render  %.2f ms avg %.2f max",
+               s->render_ms_average, s->render_ms_max);
+  SDL_snprintf(lines[n++], STATS_OVERLAY_LINE_CHARS, "present %.2f ms avg %.2f max",
+               s->present_ms_average, s->present_ms_max);
+  SDL_snprintf(lines[n++], STATS_OVERLAY_LINE_CHARS, "input   %.1f KB/s", s->bytes / 1024.0f);
+  SDL_snprintf(lines[n++], STATS_OVERLAY_LINE_CHARS, "queue   %u max, batch %.1f avg %u max",
+               s->queue_high_water, s->batch_average, s->batch_max);
+  SDL_snprintf(lines[n++], STATS_OVERLAY_LINE_CHARS, "rect %.0f char %.0f scope %.0f /s",
+               s->commands[STATS_COMMAND_RECTANGLE], s->commands[STATS_COMMAND_CHARACTER],
+               s->commands[STATS_COMMAND_WAVEFORM]);
+  SDL_snprintf(lines[n++], STATS_OVERLAY_LINE_CHARS, "keys %.0f info %.0f invalid %.0f /s",
+               s->commands[STATS_COMMAND_JOYPAD], s->commands[STATS_COMMAND_SYSTEM_INFO],
+               s->commands[STATS_COMMAND_INVALID]);
+  SDL_snprintf(lines[n++], STATS_OVERLAY_LINE_CHARS, "slip ovf %.0f esc %.0f pkt %.0f /s",
+               s->slip_errors[STATS_SLIP_BUFFER_OVERFLOW],
+               s->slip_errors[STATS_SLIP_UNKNOWN_ESCAPED_BYTE],
+               s->slip_errors[STATS_SLIP_INVALID_PACKET]);
+  return n;
+}
+
+void stats_overlay_render(SDL_Renderer *renderer, int logical_texture_width,
+                          int logical_texture_height, SDL_ScaleMode scale_mode,
+                          int font_mode_current) {
+  if (!overlay_visible) {
+    return;
+  }
+  if (overlay_texture == NULL) {
+    overlay_texture =
+        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+                          logical_texture_width, logical_texture_height);
+    if (overlay_texture == NULL) {
+      SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Couldn't create stats texture: %s", SDL_GetError());
+      return;
+    }
+    SDL_SetTextureBlendMode(overlay_texture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(overlay_texture, scale_mode);
+    overlay_needs_redraw = 1;
+  }
+
+  // Only update the overlay texture when a new summary is available
+  if (overlay_needs_redraw) {
+    overlay_needs_redraw = 0;
+
+    char lines[STATS_OVERLAY_LINES][STATS_OVERLAY_LINE_CHARS];
+    const int line_count = format_lines(lines);
+
+    SDL_Texture *prev_target = SDL_GetRenderTarget(renderer);
+    if (!SDL_SetRenderTarget(renderer, overlay_texture)) {
+      SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Failed to set render target: %s", SDL_GetError());
+    }
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+
+    inline_font_select(0);
+    const struct inline_font *font_small = fonts_get(0);
+    if (font_small) {
+
+      const int line_height = font_small->glyph_y + 1;
+      const int margin = 2;
+      int width = 0;
+      for (int i = 0; i < line_count; i++) {
+        width = SDL_max(width, (int)SDL_strlen(lines[i]) * (font_small->glyph_x + 1));
+      }
+
+      // Translucent panel behind the text in the top left corner
+      const SDL_FRect panel = {0, 0, (float)(width + margin * 2),
+                               (float)(line_count * line_height + margin * 2)};
+      SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
+      SDL_RenderFillRect(renderer, &panel);
+
+      for (int i = 0; i < line_count; i++) {
+        inprint(renderer, lines[i], margin, margin + i * line_height, 0xFFFFFF, 0xFFFFFF);
+      }
+    } else {
+      SDL_LogError(SDL_LOG_CATEGORY_RENDER, "fonts_get(0) returned NULL");
+    }
+
+    // Restore previous font mode and previous render target.
+    inline_font_select((size_t)font_mode_current);
+    SDL_SetRenderTarget(renderer, prev_target);
+  }
+
+  if (!SDL_RenderTexture(renderer, overlay_texture, NULL, NULL)) {
+    SDL_LogCritical(SDL_LOG_CATEGORY_RENDER, "Couldn't render stats overlay texture: %s",
+                    SDL_GetError());
+  }
+}
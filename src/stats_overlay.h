@@ -0,0 +1,28 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#ifndef STATS_OVERLAY_H_
+#define STATS_OVERLAY_H_
+
+#include <SDL3/SDL.h>
+
+// Toggle overlay visibility
+void stats_overlay_toggle(void);
+
+int stats_overlay_is_visible(void);
+
+// Redraw with the latest stats summary on the next render
+void stats_overlay_update(void);
+
+// Invalidate any cached resources (e.g., after texture size change)
+void stats_overlay_invalidate(void);
+
+void stats_overlay_destroy(void);
+
+// Ensure the overlay texture is up to date and composite it to the current render target
+// font_mode_current is used to restore the caller's font after drawing
+void stats_overlay_render(SDL_Renderer *renderer, int logical_texture_width,
+                          int logical_texture_height, SDL_ScaleMode texture_scaling_mode,
+                          int font_mode_current);
+
+#endif
@@ -0,0 +1,168 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#include "trace.h"
+
+// Events per thread between flushes, a power of two. Events are dropped when a buffer is full.
+#define TRACE_BUFFER_EVENTS 16384
+#define TRACE_BUFFER_MASK (TRACE_BUFFER_EVENTS - 1)
+SDL_COMPILE_TIME_ASSERT(trace_buffer_pow2, (TRACE_BUFFER_EVENTS & TRACE_BUFFER_MASK) == 0);
+#define TRACE_FLUSH_INTERVAL_MS 250
+
+typedef struct {
+  const char *name;
+  Uint64 start_ns;
+  Uint64 duration_ns;
+} trace_event_s;
+
+// Single producer (the owning thread), single consumer (trace_flush). The indices only grow.
+typedef struct trace_buffer_s {
+  trace_event_s events[TRACE_BUFFER_EVENTS];
+  struct trace_buffer_s *next;
+  SDL_ThreadID thread_id;
+  const char *thread_name; // Set by the owning thread before its first event is published
+  SDL_ALIGNED(SDL_CACHELINE_SIZE) SDL_AtomicInt written;
+  SDL_AtomicInt dropped;
+  SDL_ALIGNED(SDL_CACHELINE_SIZE) SDL_AtomicInt read;
+} trace_buffer_s;
+
+int trace_active = 0;
+
+static SDL_IOStream *trace_io = NULL;
+static SDL_TLSID buffer_tls;
+static void *buffers = NULL; // Newest first, threads only ever add to the head
+static Uint64 origin_ns;
+static Uint64 last_flush;
+static int events_written;
+
+int trace_start(const char *path) {
+  trace_io = SDL_IOFromFile(path, "w");
+  if (trace_io == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open trace file %s: %s", path,
+                 SDL_GetError());
+    return 0;
+  }
+  SDL_IOprintf(trace_io, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+  origin_ns = SDL_GetTicksNS();
+  last_flush = SDL_GetTicks();
+  events_written = 0;
+  trace_active = 1;
+  SDL_Log("Tracing to %s", path);
+  return 1;
+}
+
+static trace_buffer_s *thread_buffer(void) {
+  trace_buffer_s *buffer = SDL_GetTLS(&buffer_tls);
+  if (buffer != NULL) {
+    return buffer;
+  }
+
+  buffer = SDL_calloc(1, sizeof(*buffer));
+  if (buffer == NULL) {
+    return NULL;
+  }
+  buffer->thread_id = SDL_GetCurrentThreadID();
+  SDL_SetTLS(&buffer_tls, buffer, NULL);
+
+  do {
+    buffer->next = SDL_GetAtomicPointer(&buffers);
+  } while (!SDL_CompareAndSwapAtomicPointer(&buffers, buffer->next, buffer));
+  return buffer;
+}
+
+void trace_name_thread(const char *name) {
+  if (!trace_active) {
+    return;
+  }
+  trace_buffer_s *buffer = thread_buffer();
+  if (buffer != NULL) {
+    buffer->thread_name = name;
+  }
+}
+
+void trace_event(const char *name, Uint64 start_ns) {
+  // A trace point that began before trace_stop() ends after it
+  if (!trace_active) {
+    return;
+  }
+  const Uint64 end_ns = SDL_GetTicksNS();
+  trace_buffer_s *buffer = thread_buffer();
+  if (buffer == NULL) {
+    return;
+  }
+  // Threads that weren't named, like audio callbacks, are known by their first event
+  if (buffer->thread_name == NULL) {
+    buffer->thread_name = name;
+  }
+
+  const int written = SDL_GetAtomicInt(&buffer->written);
+  if (written - SDL_GetAtomicInt(&buffer->read) == TRACE_BUFFER_EVENTS) {
+    SDL_AddAtomicInt(&buffer->dropped, 1);
+    return;
+  }
+  trace_event_s *event = &buffer->events[written & TRACE_BUFFER_MASK];
+  event->name = name;
+  event->start_ns = start_ns;
+  event->duration_ns = end_ns - start_ns;
+  SDL_SetAtomicInt(&buffer->written, written + 1);
+}
+
+static void write_events(void) {
+  for (trace_buffer_s *buffer = SDL_GetAtomicPointer(&buffers); buffer != NULL;
+       buffer = buffer->next) {
+    int read = SDL_GetAtomicInt(&buffer->read);
+    const int written = SDL_GetAtomicInt(&buffer->written);
+    for (; read != written; read++) {
+      const trace_event_s *event = &buffer->events[read & TRACE_BUFFER_MASK];
+      const Uint64 start_ns = event->start_ns > origin_ns ? event->start_ns - origin_ns : 0;
+      SDL_IOprintf(trace_io,
+                   "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%llu,\"ts\":%.3f,"
+                   "\"dur\":%.3f}",
+                   events_written > 0 ? ",\n" : "", event->name,
+                   (unsigned long long)buffer->thread_id, (double)start_ns / 1000.0,
+                   (double)event->duration_ns / 1000.0);
+      events_written++;
+    }
+    SDL_SetAtomicInt(&buffer->read, read);
+  }
+}
+
+void trace_flush(void) {
+  if (!trace_active) {
+    return;
+  }
+  const Uint64 now = SDL_GetTicks();
+  if (now - last_flush < TRACE_FLUSH_INTERVAL_MS) {
+    return;
+  }
+  last_flush = now;
+  write_events();
+}
+
+void trace_stop(void) {
+  if (!trace_active) {
+    return;
+  }
+  trace_active = 0;
+  write_events();
+
+  // The buffers are left allocated until the process exits. Threads that m8c doesn't stop before
+  // this, like SDL's audio device thread or the libusb event thread, may still be in
+  // trace_event() and keep their buffer in thread-local storage.
+  int dropped = 0;
+  for (trace_buffer_s *buffer = SDL_GetAtomicPointer(&buffers); buffer != NULL;
+       buffer = buffer->next) {
+    SDL_IOprintf(trace_io,
+                 "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%llu,"
+                 "\"args\":{\"name\":\"%s\"}}",
+                 events_written > 0 ? ",\n" : "", (unsigned long long)buffer->thread_id,
+                 buffer->thread_name != NULL ? buffer->thread_name : "thread");
+    events_written++;
+    dropped += SDL_GetAtomicInt(&buffer->dropped);
+  }
+
+  SDL_IOprintf(trace_io, "\n]}\n");
+  SDL_CloseIO(trace_io);
+  trace_io = NULL;
+  SDL_Log("Trace finished, %d events, %d dropped", events_written, dropped);
+}
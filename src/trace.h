@@ -0,0 +1,44 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <SDL3/SDL.h>
+
+// Timeline tracing in the Chrome trace event format, viewable in Perfetto or chrome://tracing.
+// Each thread records into its own lock-free buffer, which the main thread drains to the file.
+// When tracing is off, a trace point costs one branch:
+//
+//   const Uint64 trace = trace_begin();
+//   ...
+//   trace_end("name", trace);
+//
+// Names must be string literals or otherwise outlive the trace.
+
+extern int trace_active;
+
+// Start tracing to a file, before any of the traced threads are started. Returns 1 on success.
+int trace_start(const char *path);
+
+// Write out everything recorded and close the file. Threads that are still running stop
+// recording.
+void trace_stop(void);
+
+// Write out the events recorded so far, called periodically from the main thread
+void trace_flush(void);
+
+// Name the calling thread in the trace
+void trace_name_thread(const char *name);
+
+void trace_event(const char *name, Uint64 start_ns);
+
+static inline Uint64 trace_begin(void) { return SDL_UNLIKELY(trace_active) ? SDL_GetTicksNS() : 0; }
+
+static inline void trace_end(const char *name, Uint64 start_ns) {
+  if (SDL_UNLIKELY(start_ns != 0)) {
+    trace_event(name, start_ns);
+  }
+}
+
+#endif
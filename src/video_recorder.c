@@ -0,0 +1,304 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#include "video_recorder.h"
+
+// Captured frames waiting for the writer thread, a power of two
+#define FRAME_SLOTS 8
+#define FRAME_SLOT_MASK (FRAME_SLOTS - 1)
+SDL_COMPILE_TIME_ASSERT(frame_slots_pow2, (FRAME_SLOTS & FRAME_SLOT_MASK) == 0);
+#define WRITER_INTERVAL_MS 5
+
+typedef struct {
+  Uint64 time_ns;
+  Uint8 *pixels; // BGRA32
+} video_frame_s;
+
+static SDL_IOStream *video_io = NULL;
+static SDL_Thread *writer_thread = NULL;
+static int video_width, video_height;
+static int video_y4m = 0;
+static unsigned int video_fps;
+static Uint64 video_origin_ns;
+static Uint64 stop_time_ns; // Published by stop_requested
+
+// Single producer (render thread), single consumer (writer thread). The indices only grow.
+static video_frame_s slots[FRAME_SLOTS];
+static SDL_AtomicInt slots_written;
+static SDL_AtomicInt slots_read;
+static SDL_AtomicInt stop_requested;
+
+// Render thread
+static SDL_Renderer *staging_renderer = NULL;
+static SDL_Texture *staging[2] = {NULL, NULL};
+static int staging_index = 0;
+static int staged = 0; // staging[staging_index] holds a frame that hasn't been read back
+static Uint64 staged_time_ns;
+static Uint32 frames_captured, frames_dropped;
+
+// Writer thread
+static Uint64 frames_written;
+
+static Uint8 *reserve_slot(void) {
+  const int written = SDL_GetAtomicInt(&slots_written);
+  if (written - SDL_GetAtomicInt(&slots_read) == FRAME_SLOTS) {
+    frames_dropped++;
+    return NULL;
+  }
+  return slots[written & FRAME_SLOT_MASK].pixels;
+}
+
+static void commit_slot(Uint64 time_ns) {
+  const int written = SDL_GetAtomicInt(&slots_written);
+  slots[written & FRAME_SLOT_MASK].time_ns = time_ns;
+  SDL_SetAtomicInt(&slots_written, written + 1);
+  frames_captured++;
+}
+
+// Convert a BGRA32 frame to the output format
+static void convert_frame(const Uint8 *bgra, Uint8 *out) {
+  const int count = video_width * video_height;
+
+  if (!video_y4m) {
+    SDL_memcpy(out, bgra, (size_t)count * 4);
+    return;
+  }
+
+  // 4:4:4 planes, BT.601 limited range
+  Uint8 *y_plane = out, *u_plane = out + count, *v_plane = out + 2 * count;
+  for (int i = 0; i < count; i++) {
+    const int b = bgra[i * 4], g = bgra[i * 4 + 1], r = bgra[i * 4 + 2];
+    y_plane[i] = (Uint8)(16 + ((66 * r + 129 * g + 25 * b + 128) >> 8));
+    u_plane[i] = (Uint8)(128 + ((-38 * r - 74 * g + 112 * b + 128) >> 8));
+    v_plane[i] = (Uint8)(128 + ((112 * r - 94 * g - 18 * b + 128) >> 8));
+  }
+}
+
+static Uint64 frame_index(Uint64 time_ns) {
+  return time_ns > video_origin_ns ? (time_ns - video_origin_ns) * video_fps / SDL_NS_PER_SECOND
+                                   : 0;
+}
+
+// Write the current output frame until the stream reaches frame index end
+static int write_until(const Uint8 *output, size_t output_size, Uint64 end) {
+  for (; frames_written < end; frames_written++) {
+    if ((video_y4m && SDL_WriteIO(video_io, "FRAME\n", 6) != 6) ||
+        SDL_WriteIO(video_io, output, output_size) != output_size) {
+      SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Video recording write failed: %s", SDL_GetError());
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static int SDLCALL writer_thread_func(void *data) {
+  (void)data;
+  const size_t output_size = (size_t)video_width * video_height * (video_y4m ? 3 : 4);
+  Uint8 *output = SDL_malloc(output_size);
+  Uint8 *black = SDL_calloc((size_t)video_width * video_height, 4);
+  int ok = output != NULL && black != NULL;
+
+  if (ok) {
+    // Until the first frame arrives
+    convert_frame(black, output);
+  }
+  SDL_free(black);
+
+  for (;;) {
+    const int stopping = SDL_GetAtomicInt(&stop_requested);
+
+    int read = SDL_GetAtomicInt(&slots_read);
+    while (read != SDL_GetAtomicInt(&slots_written)) {
+      const video_frame_s *frame = &slots[read & FRAME_SLOT_MASK];
+      if (ok) {
+        // A change shows from the frame it falls into; earlier changes within the same frame are
+        // overwritten
+        ok = write_until(output, output_size, frame_index(frame->time_ns));
+        convert_frame(frame->pixels, output);
+      }
+      SDL_SetAtomicInt(&slots_read, ++read);
+    }
+
+    if (stopping) {
+      if (ok) {
+        write_until(output, output_size, frame_index(stop_time_ns) + 1);
+      }
+      break;
+    }
+    SDL_Delay(WRITER_INTERVAL_MS);
+  }
+
+  SDL_free(output);
+  return 0;
+}
+
+static void free_slots(void) {
+  for (int i = 0; i < FRAME_SLOTS; i++) {
+    SDL_free(slots[i].pixels);
+    slots[i].pixels = NULL;
+  }
+}
+
+int video_recorder_start(const char *path, int width, int height, unsigned int fps,
+                         Uint64 origin_ns) {
+  video_recorder_stop();
+
+  video_width = width;
+  video_height = height;
+  video_fps = SDL_max(fps, 1);
+  video_origin_ns = origin_ns;
+  const size_t path_length = SDL_strlen(path);
+  video_y4m = path_length >= 4 && SDL_strcasecmp(path + path_length - 4, ".y4m") == 0;
+
+  for (int i = 0; i < FRAME_SLOTS; i++) {
+    slots[i].pixels = SDL_malloc((size_t)width * height * 4);
+    if (slots[i].pixels == NULL) {
+      SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Couldn't allocate video recording buffers");
+      free_slots();
+      return 0;
+    }
+  }
+
+  video_io = SDL_IOFromFile(path, "wb");
+  if (video_io == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Couldn't open video file %s: %s", path, SDL_GetError());
+    free_slots();
+    return 0;
+  }
+  if (video_y4m && !SDL_IOprintf(video_io, "YUV4MPEG2 W%d H%d F%u:1 Ip A1:1 C444\n", width,
+                                 height, video_fps)) {
+    SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Couldn't write video file %s: %s", path,
+                 SDL_GetError());
+    SDL_CloseIO(video_io);
+    video_io = NULL;
+    free_slots();
+    return 0;
+  }
+
+  SDL_SetAtomicInt(&slots_written, 0);
+  SDL_SetAtomicInt(&slots_read, 0);
+  SDL_SetAtomicInt(&stop_requested, 0);
+  frames_captured = 0;
+  frames_dropped = 0;
+  frames_written = 0;
+  staged = 0;
+
+  writer_thread = SDL_CreateThread(writer_thread_func, "video recorder", NULL);
+  if (writer_thread == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Couldn't start video recorder thread: %s",
+                 SDL_GetError());
+    SDL_CloseIO(video_io);
+    video_io = NULL;
+    free_slots();
+    return 0;
+  }
+
+  SDL_Log("Recording video to %s (%dx%d, %u fps)", path, width, height, video_fps);
+  return 1;
+}
+
+int video_recorder_is_recording(void) { return writer_thread != NULL; }
+
+void video_recorder_capture_pixels(const void *pixels, int pitch, Uint64 timestamp_ns) {
+  if (writer_thread == NULL) {
+    return;
+  }
+  Uint8 *destination = reserve_slot();
+  if (destination == NULL) {
+    return;
+  }
+  SDL_ConvertPixels(video_width, video_height, SDL_PIXELFORMAT_ARGB8888, pixels, pitch,
+                    SDL_PIXELFORMAT_BGRA32, destination, video_width * 4);
+  commit_slot(timestamp_ns);
+}
+
+static void read_back(SDL_Texture *texture, Uint64 timestamp_ns) {
+  SDL_SetRenderTarget(staging_renderer, texture);
+  SDL_Surface *surface = SDL_RenderReadPixels(staging_renderer, NULL);
+  if (surface == NULL) {
+    SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Couldn't read back video frame: %s", SDL_GetError());
+    return;
+  }
+  Uint8 *destination = reserve_slot();
+  if (destination != NULL) {
+    SDL_ConvertPixels(video_width, video_height, surface->format, surface->pixels, surface->pitch,
+                      SDL_PIXELFORMAT_BGRA32, destination, video_width * 4);
+    commit_slot(timestamp_ns);
+  }
+  SDL_DestroySurface(surface);
+}
+
+void video_recorder_capture_texture(SDL_Renderer *renderer, SDL_Texture *texture,
+                                    Uint64 timestamp_ns) {
+  if (writer_thread == NULL) {
+    return;
+  }
+
+  if (staging[0] == NULL) {
+    staging_renderer = renderer;
+    for (int i = 0; i < 2; i++) {
+      staging[i] = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                     SDL_TEXTUREACCESS_TARGET, video_width, video_height);
+      if (staging[i] == NULL) {
+        SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Couldn't create video staging texture: %s",
+                     SDL_GetError());
+        video_recorder_stop();
+        return;
+      }
+    }
+  }
+
+  // Copy this frame on the GPU, then read back the previous one, which has finished rendering by
+  // now
+  const int previous = staged;
+  const Uint64 previous_time_ns = staged_time_ns;
+  staging_index ^= 1;
+  SDL_SetRenderTarget(renderer, staging[staging_index]);
+  SDL_RenderTexture(renderer, texture, NULL, NULL);
+  staged = 1;
+  staged_time_ns = timestamp_ns;
+
+  if (previous) {
+    read_back(staging[staging_index ^ 1], previous_time_ns);
+  }
+}
+
+static void destroy_staging(void) {
+  for (int i = 0; i < 2; i++) {
+    if (staging[i] != NULL) {
+      SDL_DestroyTexture(staging[i]);
+      staging[i] = NULL;
+    }
+  }
+}
+
+void video_recorder_on_device_reset(void) {
+  // The staged frame went with the device. The writer repeats the last frame it has until the
+  // redrawn screen is captured into new staging textures.
+  staged = 0;
+  destroy_staging();
+}
+
+void video_recorder_stop(void) {
+  if (writer_thread == NULL) {
+    return;
+  }
+
+  if (staged) {
+    read_back(staging[staging_index], staged_time_ns);
+    staged = 0;
+  }
+  destroy_staging();
+
+  stop_time_ns = SDL_GetTicksNS();
+  SDL_SetAtomicInt(&stop_requested, 1);
+  SDL_WaitThread(writer_thread, NULL);
+  writer_thread = NULL;
+
+  SDL_CloseIO(video_io);
+  video_io = NULL;
+  free_slots();
+
+  SDL_Log("Video recording finished, %llu frames (%u changes captured, %u dropped)",
+          (unsigned long long)frames_written, frames_captured, frames_dropped);
+}
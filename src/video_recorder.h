@@ -0,0 +1,37 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#ifndef VIDEO_RECORDER_H_
+#define VIDEO_RECORDER_H_
+
+#include <SDL3/SDL.h>
+
+// Records the M8 screen to a video file. Frames are only captured when the screen has changed,
+// with the time of the change. A writer thread turns them into a constant frame rate stream by
+// repeating the previous frame until the next change, so an idle screen costs nothing on the
+// render thread.
+//
+// Files ending in ".y4m" get YUV4MPEG2 (4:4:4, BT.601), anything else raw BGRA frames (for
+// example ffmpeg -f rawvideo -pix_fmt bgra -video_size 320x240 -framerate 60 -i file.rgb).
+// Frame 0 starts at origin_ns, so a recording started with the audio recorder's start time lines
+// up with the audio file.
+
+// Returns 1 on success
+int video_recorder_start(const char *path, int width, int height, unsigned int fps,
+                         Uint64 origin_ns);
+void video_recorder_stop(void);
+int video_recorder_is_recording(void);
+
+// Capture a changed screen from a texture. The texture is copied on the GPU and read back on the
+// next call, so the readback doesn't wait for the frame that is being rendered. Call after
+// presenting; changes the render target.
+void video_recorder_capture_texture(SDL_Renderer *renderer, SDL_Texture *texture,
+                                    Uint64 timestamp_ns);
+
+// Capture a changed screen from ARGB8888 pixels in system memory
+void video_recorder_capture_pixels(const void *pixels, int pitch, Uint64 timestamp_ns);
+
+// Drop the staging textures after a render device reset, they are recreated on the next capture
+void video_recorder_on_device_reset(void);
+
+#endif
@@ -0,0 +1,114 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#include "waveform.h"
+
+// SDL may declare the intrinsics for runtime dispatch only, use them when they are part of the
+// target's baseline
+#if defined(SDL_SSE2_INTRINSICS) &&                                                                \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define WAVEFORM_SSE2
+#elif defined(SDL_NEON_INTRINSICS) && (defined(__ARM_NEON) || defined(_M_ARM64))
+#define WAVEFORM_NEON
+#endif
+
+// Background quad plus one quad per column
+#define WAVEFORM_MAX_QUADS (WAVEFORM_MAX_SAMPLES + 1)
+
+static SDL_Vertex vertices[WAVEFORM_MAX_QUADS * 4];
+static int indices[WAVEFORM_MAX_QUADS * 6];
+static int indices_initialized = 0;
+
+void waveform_columns(const Uint8 *samples, int count, Uint8 max_value, Uint8 *top,
+                      Uint8 *bottom) {
+  // clamped[i] is the sample before sample i, the first sample continues from itself
+  Uint8 clamped[WAVEFORM_MAX_SAMPLES + 1];
+  int i = 0;
+
+  if (count <= 0) {
+    return;
+  }
+  count = SDL_min(count, WAVEFORM_MAX_SAMPLES);
+
+#if defined(WAVEFORM_SSE2)
+  const __m128i limit = _mm_set1_epi8((char)max_value);
+  for (; i + 16 <= count; i += 16) {
+    const __m128i s = _mm_min_epu8(_mm_loadu_si128((const __m128i *)&samples[i]), limit);
+    _mm_storeu_si128((__m128i *)&clamped[i + 1], s);
+  }
+#elif defined(WAVEFORM_NEON)
+  const uint8x16_t limit = vdupq_n_u8(max_value);
+  for (; i + 16 <= count; i += 16) {
+    vst1q_u8(&clamped[i + 1], vminq_u8(vld1q_u8(&samples[i]), limit));
+  }
+#endif
+  for (; i < count; i++) {
+    clamped[i + 1] = SDL_min(samples[i], max_value);
+  }
+  clamped[0] = clamped[1];
+
+  i = 0;
+#if defined(WAVEFORM_SSE2)
+  for (; i + 16 <= count; i += 16) {
+    const __m128i previous = _mm_loadu_si128((const __m128i *)&clamped[i]);
+    const __m128i current = _mm_loadu_si128((const __m128i *)&clamped[i + 1]);
+    _mm_storeu_si128((__m128i *)&top[i], _mm_min_epu8(previous, current));
+    _mm_storeu_si128((__m128i *)&bottom[i], _mm_max_epu8(previous, current));
+  }
+#elif defined(WAVEFORM_NEON)
+  for (; i + 16 <= count; i += 16) {
+    const uint8x16_t previous = vld1q_u8(&clamped[i]);
+    const uint8x16_t current = vld1q_u8(&clamped[i + 1]);
+    vst1q_u8(&top[i], vminq_u8(previous, current));
+    vst1q_u8(&bottom[i], vmaxq_u8(previous, current));
+  }
+#endif
+  for (; i < count; i++) {
+    top[i] = SDL_min(clamped[i], clamped[i + 1]);
+    bottom[i] = SDL_max(clamped[i], clamped[i + 1]);
+  }
+}
+
+static SDL_FColor to_fcolor(SDL_Color color) {
+  return (SDL_FColor){color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+}
+
+static void set_quad(SDL_Vertex *v, float x0, float y0, float x1, float y1, SDL_FColor color) {
+  v[0] = (SDL_Vertex){{x0, y0}, color, {0, 0}};
+  v[1] = (SDL_Vertex){{x1, y0}, color, {0, 0}};
+  v[2] = (SDL_Vertex){{x1, y1}, color, {0, 0}};
+  v[3] = (SDL_Vertex){{x0, y1}, color, {0, 0}};
+}
+
+void waveform_render(SDL_Renderer *renderer, const SDL_FRect *background,
+                     SDL_Color background_color, float x, const Uint8 *top, const Uint8 *bottom,
+                     int count, SDL_Color color) {
+  if (!indices_initialized) {
+    for (int q = 0; q < WAVEFORM_MAX_QUADS; q++) {
+      const int base = q * 4;
+      int *index = &indices[q * 6];
+      index[0] = base;
+      index[1] = base + 1;
+      index[2] = base + 2;
+      index[3] = base;
+      index[4] = base + 2;
+      index[5] = base + 3;
+    }
+    indices_initialized = 1;
+  }
+
+  count = SDL_clamp(count, 0, WAVEFORM_MAX_SAMPLES);
+
+  // Triangles are drawn in order, so the columns end up on top of the background
+  set_quad(vertices, background->x, background->y, background->x + background->w,
+           background->y + background->h, to_fcolor(background_color));
+  const SDL_FColor fcolor = to_fcolor(color);
+  for (int i = 0; i < count; i++) {
+    set_quad(&vertices[(i + 1) * 4], x + (float)i, top[i], x + (float)(i + 1),
+             (float)bottom[i] + 1.0f, fcolor);
+  }
+
+  if (!SDL_RenderGeometry(renderer, NULL, vertices, (count + 1) * 4, indices, (count + 1) * 6)) {
+    SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Couldn't draw waveform: %s", SDL_GetError());
+  }
+}
@@ -0,0 +1,26 @@
+// Copyright 2026 Jonne Kokkonen
+// Released under the MIT licence, https://opensource.org/licenses/MIT
+
+#ifndef WAVEFORM_H_
+#define WAVEFORM_H_
+
+#include <SDL3/SDL.h>
+
+// Samples in one oscilloscope command (Model:02 screen width)
+#define WAVEFORM_MAX_SAMPLES 480
+
+// The oscilloscope waveform is drawn as one pixel wide columns, each reaching from its sample to
+// the previous one, so that the samples form a connected line. A flat waveform looks the same as
+// plain points.
+
+// Clamp the samples to max_value to avoid random glitches and compute the columns: column i
+// covers the rows top[i]..bottom[i], inclusive. Count is at most WAVEFORM_MAX_SAMPLES.
+void waveform_columns(const Uint8 *samples, int count, Uint8 max_value, Uint8 *top, Uint8 *bottom);
+
+// Fill the background rectangle and draw the columns starting at x with one SDL_RenderGeometry
+// call
+void waveform_render(SDL_Renderer *renderer, const SDL_FRect *background,
+                     SDL_Color background_color, float x, const Uint8 *top, const Uint8 *bottom,
+                     int count, SDL_Color color);
+
+#endif